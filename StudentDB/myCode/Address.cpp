@@ -9,6 +9,8 @@
 
 #include "Address.h"
 
+#include "ModelFields.h"
+
 using namespace std;
 
 Address::Address(std::string street, unsigned short postalCode,
@@ -44,10 +46,7 @@ const std::string& Address::getadditionalInfo() const
 
 void Address::write(std::ostream &out) const
 {
-	out << this->m_street
-			<< ";" << to_string(this->m_postalCode)
-			<< ";" << this->m_cityName
-			<< ";" << this->m_additionalInfo;
+	writeFieldsText(out, *this, addressFields());
 }
 
 std::shared_ptr<Address> Address::read(std::istream &in)
@@ -55,37 +54,38 @@ std::shared_ptr<Address> Address::read(std::istream &in)
 	string inStr;
 	getline(in, inStr);
 
-	string street = splitAt(inStr, ';');
-	unsigned int postalCode = stoi(splitAt(inStr, ';'));
-	string city = splitAt(inStr, ';');
-	string additionalInfo = splitAt(inStr, ';');
+	auto values = readFieldsText(inStr, addressFields());
 
-	return make_shared<Address>(street, postalCode, city, additionalInfo);
+	return applyValues([](auto&&... fields)
+			{ return make_shared<Address>(forward<decltype(fields)>(fields)...); }, values);
 }
 
 Poco::JSON::Object::Ptr Address::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	returnObj->set("street", this->m_street);
-	returnObj->set("postalCode", this->m_postalCode);
-	returnObj->set("cityName", this->m_cityName);
-	returnObj->set("additionalInfo", this->m_additionalInfo);
+	writeFieldsJson(*returnObj, *this, addressFields());
 
 	return returnObj;
 }
 
 std::shared_ptr<Address> Address::fromJson(Poco::JSON::Object::Ptr data)
 {
-	Poco::DynamicStruct jsonDataStruct = *data;
-
-	string street = jsonDataStruct["street"].toString();
+	auto values = readFieldsJson(*data, addressFields());
 
-	unsigned int postalCode = jsonDataStruct["postalCode"];
+	return applyValues([](auto&&... fields)
+			{ return make_shared<Address>(forward<decltype(fields)>(fields)...); }, values);
+}
 
-	string city = jsonDataStruct["cityName"].toString();
+void Address::writeBinary(std::ostream &out) const
+{
+	writeFieldsBinary(out, *this, addressFields());
+}
 
-	string additionalInfo = jsonDataStruct["additionalInfo"].toString();
+std::shared_ptr<Address> Address::readBinary(std::istream &in)
+{
+	auto values = readFieldsBinary(in, addressFields());
 
-	return make_shared<Address>(street, postalCode, city, additionalInfo);
+	return applyValues([](auto&&... fields)
+			{ return make_shared<Address>(forward<decltype(fields)>(fields)...); }, values);
 }
@@ -137,6 +137,22 @@ public:
 	 */
 	static std::shared_ptr<Address> fromJson(Poco::JSON::Object::Ptr data);
 
+	/*!
+	 * @brief Writes the Address information in the binary format.
+	 *
+	 * @param out The output stream to which the Address will be written.
+	 */
+	void writeBinary(std::ostream& out) const;
+
+	/*!
+	 * @brief Reads an Address written by writeBinary().
+	 *
+	 * @param in The input stream from which to read the Address.
+	 * @return A shared pointer to the dynamically allocated Address object.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static std::shared_ptr<Address> readBinary(std::istream& in);
+
 };
 
 #endif /* ADDRESS_H_ */
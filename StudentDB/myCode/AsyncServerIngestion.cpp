@@ -0,0 +1,491 @@
+/*!
+ * @file AsyncServerIngestion.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "AsyncServerIngestion.h"
+
+#include <deque>
+
+using namespace std;
+
+namespace asio = boost::asio;
+using boost::asio::ip::tcp;
+
+struct AsyncServerIngestion::Session : public enable_shared_from_this<Session>
+{
+	/*!
+	 * @var index - Number of the connection, for the report.
+	 */
+	unsigned int index;
+
+	/*!
+	 * @var strand - Serializes the completion handlers of the connection.
+	 */
+	asio::strand<asio::io_context::executor_type> strand;
+
+	/*!
+	 * @var socket - The connection to the server.
+	 */
+	tcp::socket socket;
+
+	/*!
+	 * @var readBuffer - Received data not yet split into lines.
+	 */
+	asio::streambuf readBuffer;
+
+	/*!
+	 * @var writeBuffer - The requests of the running write.
+	 */
+	string writeBuffer;
+
+	/*!
+	 * @var writing - True while a write is running.
+	 */
+	bool writing;
+
+	/*!
+	 * @var finished - True once the session has quit or failed.
+	 */
+	bool finished;
+
+	/*!
+	 * @var paused - True while pendingRecord waits for room in the queue,
+	 * no read is running then.
+	 */
+	bool paused;
+
+	/*!
+	 * @var pendingRecord - The record that did not fit into the queue.
+	 */
+	StudentRecord pendingRecord;
+
+	/*!
+	 * @var inFlight - Requests sent without a response.
+	 */
+	unsigned int inFlight;
+
+	/*!
+	 * @var sentAt - Send times of the requests in flight, in order.
+	 */
+	deque<chrono::steady_clock::time_point> sentAt;
+
+	/*!
+	 * @var connectStart - Start of the connection attempt.
+	 */
+	chrono::steady_clock::time_point connectStart;
+
+	/*!
+	 * @var lineInResponse - Position of the next line in its response,
+	 * 0 for the status line, 1 for the JSON data, 2 for the final status.
+	 */
+	unsigned int lineInResponse;
+
+	/*!
+	 * @var received, rejected, error - The report of the connection.
+	 */
+	unsigned int received;
+	unsigned int rejected;
+	string error;
+
+	Session(unsigned int sessionIdx, asio::io_context& ioContext) :
+		index(sessionIdx), strand(asio::make_strand(ioContext)),
+		socket(strand), writing(false), finished(false), paused(false),
+		inFlight(0), lineInResponse(0), received(0), rejected(0)
+	{
+	}
+};
+
+AsyncServerIngestion::AsyncServerIngestion(const std::string &host,
+		const std::string &port, unsigned int noOfConnections,
+		unsigned int pipelineDepth, unsigned int noOfThreads,
+		IngestionMetrics &metrics) :
+				m_host(host), m_port(port),
+				m_noOfConnections(max(noOfConnections, 1u)),
+				m_pipelineDepth(max(pipelineDepth, 1u)),
+				m_noOfThreads(max(noOfThreads, 1u)),
+				m_unclaimed(0), m_unanswered(0), m_activeSessions(0),
+				m_records(m_noOfConnections * m_pipelineDepth * 4),
+				m_metrics(metrics)
+{
+}
+
+AsyncServerIngestion::~AsyncServerIngestion()
+{
+}
+
+unsigned int AsyncServerIngestion::run(unsigned int noOfUserData,
+		const std::function<unsigned int(std::vector<StudentRecord>)> &insertBatch,
+		std::ostream &report)
+{
+	tcp::resolver resolver(this->m_ioContext);
+
+	tcp::resolver::results_type endpoints = resolver.resolve(this->m_host, this->m_port);
+
+	this->m_unclaimed = noOfUserData;
+	this->m_unanswered = noOfUserData;
+	this->m_activeSessions = this->m_noOfConnections;
+
+	for(unsigned int sessionIdx = 0; sessionIdx < this->m_noOfConnections; sessionIdx++)
+	{
+		this->m_sessions.push_back(make_shared<Session>(sessionIdx, this->m_ioContext));
+
+		this->startSession(this->m_sessions.back(), endpoints);
+	}
+
+	vector<thread> ioThreads;
+
+	for(unsigned int threadIdx = 0; threadIdx < this->m_noOfThreads; threadIdx++)
+	{
+		ioThreads.emplace_back([this]() { this->m_ioContext.run(); });
+	}
+
+	unsigned int inserted = 0;
+
+	vector<StudentRecord> batch;
+
+	while(this->m_records.popAll(batch))
+	{
+		vector<shared_ptr<Session>> paused;
+
+		{
+			lock_guard<mutex> waitingLock(this->m_waitingMutex);
+
+			paused.swap(this->m_paused);
+		}
+
+		//! The queue has room again, let the paused sessions parse on
+		//! while this thread inserts.
+		for(const shared_ptr<Session>& session : paused)
+		{
+			asio::post(session->strand, [this, session]() { this->resumeSession(session); });
+		}
+
+		inserted += insertBatch(move(batch));
+
+		batch.clear();
+	}
+
+	for(thread& ioThread : ioThreads)
+	{
+		ioThread.join();
+	}
+
+	for(const shared_ptr<Session>& session : this->m_sessions)
+	{
+		report << "Connection " << session->index + 1 << ": " << session->received
+				<< " received, " << session->rejected << " rejected" << endl;
+
+		if(!session->error.empty())
+		{
+			report << "Connection " << session->index + 1 << " failed: " << session->error << endl;
+		}
+	}
+
+	report << inserted << " of " << noOfUserData << " User Data added, "
+			<< this->m_unanswered.load() << " not received" << endl;
+
+	return inserted;
+}
+
+bool AsyncServerIngestion::claimRequest()
+{
+	unsigned int available = this->m_unclaimed.load();
+
+	while(available > 0)
+	{
+		if(this->m_unclaimed.compare_exchange_weak(available, available - 1))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void AsyncServerIngestion::startSession(std::shared_ptr<Session> session,
+		const tcp::resolver::results_type &endpoints)
+{
+	session->connectStart = chrono::steady_clock::now();
+
+	asio::async_connect(session->socket, endpoints, asio::bind_executor(session->strand,
+			[this, session](const boost::system::error_code& ec, const tcp::endpoint&)
+	{
+		if(ec)
+		{
+			this->failSession(session, ec);
+		}
+		else
+		{
+			this->m_metrics.recordConnect(chrono::steady_clock::now() - session->connectStart);
+
+			this->readNextLine(session);
+			this->fillPipeline(session);
+		}
+	}));
+}
+
+void AsyncServerIngestion::fillPipeline(std::shared_ptr<Session> session)
+{
+	if(session->writing || session->finished || session->paused)
+	{
+		return;
+	}
+
+	string requests;
+
+	while(session->inFlight < this->m_pipelineDepth && this->claimRequest())
+	{
+		requests += "generate\n";
+		session->inFlight++;
+		session->sentAt.push_back(chrono::steady_clock::now());
+	}
+
+	if(requests.empty())
+	{
+		if(session->inFlight > 0)
+		{
+			//! The responses of the pipeline will call again.
+			return;
+		}
+
+		if(this->m_unanswered.load() == 0)
+		{
+			this->quitSession(session);
+
+			return;
+		}
+
+		//! Requests released by a failed connection may still show up,
+		//! checked again under the lock so that no wake-up is missed.
+		unique_lock<mutex> waitingLock(this->m_waitingMutex);
+
+		if(this->m_unclaimed.load() == 0 && this->m_unanswered.load() > 0)
+		{
+			this->m_idle.push_back(session);
+
+			return;
+		}
+
+		waitingLock.unlock();
+
+		asio::post(session->strand, [this, session]() { this->fillPipeline(session); });
+
+		return;
+	}
+
+	session->writing = true;
+	session->writeBuffer = move(requests);
+
+	asio::async_write(session->socket, asio::buffer(session->writeBuffer),
+			asio::bind_executor(session->strand,
+					[this, session](const boost::system::error_code& ec, size_t)
+	{
+		session->writing = false;
+
+		if(ec)
+		{
+			this->failSession(session, ec);
+		}
+		else
+		{
+			this->fillPipeline(session);
+		}
+	}));
+}
+
+void AsyncServerIngestion::readNextLine(std::shared_ptr<Session> session)
+{
+	asio::async_read_until(session->socket, session->readBuffer, '\n',
+			asio::bind_executor(session->strand,
+					[this, session](const boost::system::error_code& ec, size_t)
+	{
+		if(ec)
+		{
+			this->failSession(session, ec);
+
+			return;
+		}
+
+		string line;
+
+		istream lineStream(&session->readBuffer);
+
+		getline(lineStream, line);
+
+		if(!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		this->handleLine(session, line);
+
+		if(!session->finished && !session->paused)
+		{
+			this->readNextLine(session);
+		}
+	}));
+}
+
+void AsyncServerIngestion::handleLine(std::shared_ptr<Session> session,
+		const std::string &line)
+{
+	if(session->lineInResponse == 1)
+	{
+		//! The request counts as answered once its JSON data has arrived.
+		session->inFlight--;
+		session->received++;
+
+		if(--this->m_unanswered == 0)
+		{
+			//! The sessions without work can quit now.
+			this->wakeIdleSessions();
+		}
+
+		this->m_metrics.recordRequest(chrono::steady_clock::now() - session->sentAt.front());
+		session->sentAt.pop_front();
+
+		if(this->m_metrics.scanRecord(line, session->pendingRecord))
+		{
+			this->pushRecord(session);
+		}
+		else
+		{
+			session->rejected++;
+		}
+	}
+
+	session->lineInResponse = (session->lineInResponse + 1) % 3;
+
+	if(session->lineInResponse == 0)
+	{
+		this->fillPipeline(session);
+	}
+}
+
+bool AsyncServerIngestion::pushRecord(std::shared_ptr<Session> session)
+{
+	if(this->m_records.tryPush(session->pendingRecord))
+	{
+		return true;
+	}
+
+	//! Tried again under the lock, the inserting thread takes the paused
+	//! sessions under the same lock after it has emptied the queue.
+	lock_guard<mutex> waitingLock(this->m_waitingMutex);
+
+	if(this->m_records.tryPush(session->pendingRecord))
+	{
+		return true;
+	}
+
+	session->paused = true;
+
+	this->m_paused.push_back(session);
+
+	return false;
+}
+
+void AsyncServerIngestion::resumeSession(std::shared_ptr<Session> session)
+{
+	session->paused = false;
+
+	if(!this->pushRecord(session))
+	{
+		return;
+	}
+
+	if(session->finished)
+	{
+		//! The session failed while paused, its record is queued now.
+		this->finishSession();
+
+		return;
+	}
+
+	this->readNextLine(session);
+	this->fillPipeline(session);
+}
+
+void AsyncServerIngestion::wakeIdleSessions()
+{
+	vector<shared_ptr<Session>> idle;
+
+	{
+		lock_guard<mutex> waitingLock(this->m_waitingMutex);
+
+		idle.swap(this->m_idle);
+	}
+
+	for(const shared_ptr<Session>& session : idle)
+	{
+		asio::post(session->strand, [this, session]() { this->fillPipeline(session); });
+	}
+}
+
+void AsyncServerIngestion::quitSession(std::shared_ptr<Session> session)
+{
+	session->finished = true;
+	session->writing = true;
+	session->writeBuffer = "quit\n";
+
+	asio::async_write(session->socket, asio::buffer(session->writeBuffer),
+			asio::bind_executor(session->strand,
+					[this, session](const boost::system::error_code&, size_t)
+	{
+		boost::system::error_code ignored;
+
+		session->socket.shutdown(tcp::socket::shutdown_both, ignored);
+		session->socket.close(ignored);
+
+		this->finishSession();
+	}));
+}
+
+void AsyncServerIngestion::failSession(std::shared_ptr<Session> session,
+		const boost::system::error_code &error)
+{
+	if(session->finished)
+	{
+		return;
+	}
+
+	session->finished = true;
+	session->error = error.message();
+
+	this->m_metrics.countError(boost::system::system_error(error));
+
+	//! Hand the unanswered requests over to the other connections.
+	bool released = session->inFlight > 0;
+
+	this->m_unclaimed += session->inFlight;
+	session->inFlight = 0;
+	session->sentAt.clear();
+
+	boost::system::error_code ignored;
+
+	session->socket.close(ignored);
+
+	if(released)
+	{
+		this->wakeIdleSessions();
+	}
+
+	if(!session->paused)
+	{
+		//! A paused session is finished once its record is queued.
+		this->finishSession();
+	}
+}
+
+void AsyncServerIngestion::finishSession()
+{
+	if(--this->m_activeSessions == 0)
+	{
+		this->m_records.close();
+	}
+}
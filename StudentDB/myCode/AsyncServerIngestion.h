@@ -0,0 +1,231 @@
+/*!
+ * @file AsyncServerIngestion.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef ASYNCSERVERINGESTION_H_
+#define ASYNCSERVERINGESTION_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "helperFunctions.h"
+#include "ImportRecords.h"
+#include "BoundedQueue.h"
+#include "IngestionMetrics.h"
+
+/*!
+ * @class AsyncServerIngestion
+ * @brief Fetches student data from the generator server with
+ * asynchronous sockets.
+ *
+ * All connections are driven by one boost::asio::io_context, which is run
+ * by a small number of threads. Every connection keeps a pipeline of
+ * "generate" requests in flight and parses the responses as they arrive,
+ * so parsing overlaps with the waits of the other connections. The parsed
+ * records are passed through a bounded queue to the thread that called
+ * run(), the only thread that inserts them.
+ *
+ * No handler waits: a connection that finds the queue full stops reading
+ * until the inserting thread has taken the queued records, a connection
+ * without work waits until a failed connection releases its requests or
+ * all requests are answered.
+ */
+class AsyncServerIngestion
+{
+private:
+	/*!
+	 * @brief The state of one connection, only accessed through its strand.
+	 */
+	struct Session;
+
+	/*!
+	 * @var m_ioContext - Runs the completion handlers of all connections.
+	 */
+	boost::asio::io_context m_ioContext;
+
+	/*!
+	 * @var m_host - Host name of the generator server.
+	 */
+	std::string m_host;
+
+	/*!
+	 * @var m_port - Port of the generator server.
+	 */
+	std::string m_port;
+
+	/*!
+	 * @var m_noOfConnections - Number of connections to the server.
+	 */
+	unsigned int m_noOfConnections;
+
+	/*!
+	 * @var m_pipelineDepth - Maximum number of requests waiting for
+	 * a response, per connection.
+	 */
+	unsigned int m_pipelineDepth;
+
+	/*!
+	 * @var m_noOfThreads - Number of threads running the io_context.
+	 */
+	unsigned int m_noOfThreads;
+
+	/*!
+	 * @var m_unclaimed - Requests not yet claimed by a connection.
+	 */
+	std::atomic<unsigned int> m_unclaimed;
+
+	/*!
+	 * @var m_unanswered - Requests without a response, claimed or not.
+	 */
+	std::atomic<unsigned int> m_unanswered;
+
+	/*!
+	 * @var m_activeSessions - Connections that have not finished yet.
+	 */
+	std::atomic<unsigned int> m_activeSessions;
+
+	/*!
+	 * @var m_records - The parsed records on their way to the inserting thread.
+	 */
+	BoundedQueue<StudentRecord> m_records;
+
+	/*!
+	 * @var m_metrics - Receives the latencies and counters of the run.
+	 */
+	IngestionMetrics& m_metrics;
+
+	/*!
+	 * @var m_sessions - All connections, kept for the report.
+	 */
+	std::vector<std::shared_ptr<Session>> m_sessions;
+
+	/*!
+	 * @var m_waitingMutex - Guards m_paused and m_idle.
+	 */
+	std::mutex m_waitingMutex;
+
+	/*!
+	 * @var m_paused - Connections that stopped reading since the queue was full.
+	 */
+	std::vector<std::shared_ptr<Session>> m_paused;
+
+	/*!
+	 * @var m_idle - Connections without work, while other connections
+	 * still wait for responses.
+	 */
+	std::vector<std::shared_ptr<Session>> m_idle;
+
+	/*!
+	 * @brief Claims one request from the shared count.
+	 *
+	 * @return True if a request was claimed.
+	 */
+	bool claimRequest();
+
+	/*!
+	 * @brief Connects a session and starts reading and writing.
+	 */
+	void startSession(std::shared_ptr<Session> session,
+			const boost::asio::ip::tcp::resolver::results_type& endpoints);
+
+	/*!
+	 * @brief Sends as many claimed requests as the pipeline of the session
+	 * takes, or ends the session once there is no work left.
+	 */
+	void fillPipeline(std::shared_ptr<Session> session);
+
+	/*!
+	 * @brief Starts the asynchronous read of the next response line.
+	 */
+	void readNextLine(std::shared_ptr<Session> session);
+
+	/*!
+	 * @brief Processes one line of a response.
+	 */
+	void handleLine(std::shared_ptr<Session> session, const std::string& line);
+
+	/*!
+	 * @brief Queues the pending record of a session, or pauses the
+	 * session until the inserting thread has made room.
+	 *
+	 * @return False if the session was paused.
+	 */
+	bool pushRecord(std::shared_ptr<Session> session);
+
+	/*!
+	 * @brief Continues a paused session, on its strand.
+	 */
+	void resumeSession(std::shared_ptr<Session> session);
+
+	/*!
+	 * @brief Posts fillPipeline() for every session without work.
+	 */
+	void wakeIdleSessions();
+
+	/*!
+	 * @brief Sends "quit" and closes the connection of the session.
+	 */
+	void quitSession(std::shared_ptr<Session> session);
+
+	/*!
+	 * @brief Ends a session after an error, its unanswered requests
+	 * are handed over to the other sessions.
+	 */
+	void failSession(std::shared_ptr<Session> session, const boost::system::error_code& error);
+
+	/*!
+	 * @brief Counts a session as finished, the queue is closed
+	 * once all sessions are finished.
+	 */
+	void finishSession();
+
+public:
+	/*!
+	 * @brief Constructor.
+	 *
+	 * @param host Host name of the generator server.
+	 * @param port Port of the generator server.
+	 * @param noOfConnections Number of connections to the server.
+	 * @param pipelineDepth Maximum number of requests waiting for a
+	 * response, per connection.
+	 * @param noOfThreads Number of threads running the socket I/O
+	 * and the parsing.
+	 * @param metrics Receives the latencies and counters of the run.
+	 */
+	AsyncServerIngestion(const std::string& host, const std::string& port,
+			unsigned int noOfConnections, unsigned int pipelineDepth,
+			unsigned int noOfThreads, IngestionMetrics& metrics);
+
+	/*!
+	 * @brief Destructor.
+	 */
+	~AsyncServerIngestion();
+
+	/*!
+	 * @brief Fetches noOfUserData responses and passes the valid
+	 * records in batches to insertBatch, on the calling thread.
+	 *
+	 * Prints the received and rejected records and the error of every
+	 * connection. run() is called once per AsyncServerIngestion object.
+	 *
+	 * @param noOfUserData Number of responses to be requested.
+	 * @param insertBatch Called with the records parsed since its last
+	 * call, returns the number of records it added.
+	 * @param report Receives the counts and errors of the connections.
+	 * @return Number of records added by insertBatch.
+	 * @throws boost::system::system_error if the host can't be resolved.
+	 */
+	unsigned int run(unsigned int noOfUserData,
+			const std::function<unsigned int(std::vector<StudentRecord>)>& insertBatch,
+			std::ostream& report);
+};
+
+#endif /* ASYNCSERVERINGESTION_H_ */
@@ -0,0 +1,79 @@
+/*!
+ * @file AsyncStudentDb.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "AsyncStudentDb.h"
+
+using namespace std;
+
+AsyncStudentDb::AsyncStudentDb(StudentDb &db, unsigned int noOfThreads) :
+		m_db(db), m_executor(max(noOfThreads, 1u))
+{
+}
+
+AsyncStudentDb::~AsyncStudentDb()
+{
+}
+
+std::future<unsigned int> AsyncStudentDb::addStudent(StudentRecord record)
+{
+	return this->post([this, record]()
+	{
+		vector<unsigned int> matrikelNumbers;
+
+		this->m_db.addStudentsBatch(vector<StudentRecord>(1, record), matrikelNumbers);
+
+		return matrikelNumbers.at(0);
+	});
+}
+
+std::future<StudentDb::RC_StudentDb_t> AsyncStudentDb::enroll(unsigned int matrikelNumber,
+		unsigned int courseKey, const std::string &semester)
+{
+	return this->post([this, matrikelNumber, courseKey, semester]()
+	{
+		string matrikelText = to_string(matrikelNumber);
+		string semesterText = semester;
+		string courseKeyText = to_string(courseKey);
+
+		return this->m_db.addEnrollment(matrikelText, semesterText, courseKeyText);
+	});
+}
+
+std::future<StudentDb::RC_StudentDb_t> AsyncStudentDb::updateGrade(
+		unsigned int matrikelNumber, unsigned int courseKey, float grade)
+{
+	return this->post([this, matrikelNumber, courseKey, grade]()
+	{
+		return this->m_db.updateGrade(courseKey, grade, matrikelNumber);
+	});
+}
+
+std::future<Student> AsyncStudentDb::lookup(unsigned int matrikelNumber)
+{
+	return this->post([this, matrikelNumber]()
+	{
+		return this->m_db.getStudent(matrikelNumber);
+	});
+}
+
+std::future<void> AsyncStudentDb::save(const std::string &fileName)
+{
+	return this->post([this, fileName]()
+	{
+		this->m_db.saveToFile(fileName);
+	});
+}
+
+std::future<unsigned int> AsyncStudentDb::ingest(unsigned int noOfUserData)
+{
+	return this->post([this, noOfUserData]()
+	{
+		return this->m_db.readStudentDataFromServerPipelined(noOfUserData);
+	});
+}
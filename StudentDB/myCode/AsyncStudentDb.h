@@ -0,0 +1,128 @@
+/*!
+ * @file AsyncStudentDb.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef ASYNCSTUDENTDB_H_
+#define ASYNCSTUDENTDB_H_
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "StudentDb.h"
+#include "WorkStealingPool.h"
+
+/*!
+ * @class AsyncStudentDb
+ * @brief Asynchronous operations on a StudentDb, each returning a
+ * std::future of its result.
+ *
+ * The operations run on a few executor threads of their own, apart from
+ * the shared WorkStealingPool, since saving and fetching from the server
+ * wait for the disk or the network. Many callers can start operations
+ * at once without blocking, the queued operations are done in the order
+ * the executor threads take them. Exceptions of an operation are thrown
+ * by std::future::get().
+ *
+ * Server fetches are done one at a time by the database, since they
+ * share its ingestion metrics.
+ */
+class AsyncStudentDb
+{
+private:
+	/*!
+	 * @var m_db - The database of the operations.
+	 */
+	StudentDb& m_db;
+
+	/*!
+	 * @var m_executor - The threads running the operations, declared last
+	 * so they are done before the other members are destroyed.
+	 */
+	WorkStealingPool m_executor;
+
+public:
+	/*!
+	 * @brief Constructor.
+	 *
+	 * @param db The database of the operations, it must outlive this object.
+	 * @param noOfThreads Number of executor threads.
+	 */
+	AsyncStudentDb(StudentDb& db, unsigned int noOfThreads = 4);
+
+	/*!
+	 * @brief Destructor, waits for all started operations.
+	 */
+	~AsyncStudentDb();
+
+	/*!
+	 * @brief Runs any operation on the executor.
+	 *
+	 * @param operation Called without arguments on an executor thread.
+	 * @return The future of the result of operation.
+	 */
+	template<typename Operation>
+	auto post(Operation operation) -> std::future<decltype(operation())>
+	{
+		typedef decltype(operation()) Result;
+
+		//! Shared, since std::function needs a copyable task.
+		std::shared_ptr<std::packaged_task<Result()>> task =
+				std::make_shared<std::packaged_task<Result()>>(std::move(operation));
+
+		std::future<Result> result = task->get_future();
+
+		this->m_executor.submit([task](){ (*task)(); });
+
+		return result;
+	}
+
+	/*!
+	 * @brief Adds a student, see StudentDb::addStudentsBatch().
+	 *
+	 * @return The future of the matrikel number of the student, 0 if it
+	 * was a duplicate.
+	 */
+	std::future<unsigned int> addStudent(StudentRecord record);
+
+	/*!
+	 * @brief Enrolls a student in a course, see StudentDb::addEnrollment().
+	 */
+	std::future<StudentDb::RC_StudentDb_t> enroll(unsigned int matrikelNumber,
+			unsigned int courseKey, const std::string& semester);
+
+	/*!
+	 * @brief Updates a grade, see StudentDb::updateGrade().
+	 */
+	std::future<StudentDb::RC_StudentDb_t> updateGrade(unsigned int matrikelNumber,
+			unsigned int courseKey, float grade);
+
+	/*!
+	 * @brief Looks up a student.
+	 *
+	 * @return The future of a copy of the student, get() throws
+	 * std::out_of_range if there is no such student.
+	 */
+	std::future<Student> lookup(unsigned int matrikelNumber);
+
+	/*!
+	 * @brief Writes the database to a file, see StudentDb::saveToFile().
+	 */
+	std::future<void> save(const std::string& fileName);
+
+	/*!
+	 * @brief Fetches students from the generator server, see
+	 * StudentDb::readStudentDataFromServerPipelined().
+	 *
+	 * @return The future of the number of students added.
+	 */
+	std::future<unsigned int> ingest(unsigned int noOfUserData);
+};
+
+#endif /* ASYNCSTUDENTDB_H_ */
@@ -0,0 +1,264 @@
+/*!
+ * @file BatchCommandRunner.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "BatchCommandRunner.h"
+#include "helperFunctions.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+BatchCommandRunner::BatchCommandRunner(StudentDb &db, unsigned int batchSize) :
+		m_db(db), m_batchSize(max(batchSize, 1u)), m_noOfCommands(0), m_failures(0)
+{
+}
+
+std::vector<std::string> BatchCommandRunner::splitFields(const std::string &line)
+{
+	vector<string> fields;
+
+	size_t begin = 0;
+
+	while(true)
+	{
+		size_t end = line.find(';', begin);
+
+		if(end == string::npos)
+		{
+			fields.push_back(line.substr(begin));
+
+			return fields;
+		}
+
+		fields.push_back(line.substr(begin, end - begin));
+
+		begin = end + 1;
+	}
+}
+
+std::string BatchCommandRunner::resultName(StudentDb::RC_StudentDb_t result)
+{
+	switch(result)
+	{
+	case StudentDb::RC_StudentDb_t::RC_Success:
+		return "RC_Success";
+	case StudentDb::RC_StudentDb_t::RC_Wrong_Course_Key:
+		return "RC_Wrong_Course_Key";
+	case StudentDb::RC_StudentDb_t::RC_Wrong_MatrikelNumber:
+		return "RC_Wrong_MatrikelNumber";
+	case StudentDb::RC_StudentDb_t::RC_Student_Exists:
+		return "RC_Student_Exists";
+	case StudentDb::RC_StudentDb_t::RC_Course_Exists:
+		return "RC_Course_Exists";
+	case StudentDb::RC_StudentDb_t::RC_Enrollment_Exists:
+		return "RC_Enrollment_Exists";
+	case StudentDb::RC_StudentDb_t::RC_Invalid_Semester_Added:
+		return "RC_Invalid_Semester_Added";
+	}
+
+	return "RC_Unknown";
+}
+
+void BatchCommandRunner::reportResult(std::ostream &report, unsigned int lineNo,
+		StudentDb::RC_StudentDb_t result)
+{
+	if(result != StudentDb::RC_StudentDb_t::RC_Success)
+	{
+		this->m_failures++;
+	}
+
+	report << lineNo << ';' << resultName(result) << '\n';
+}
+
+void BatchCommandRunner::reportError(std::ostream &report, unsigned int lineNo,
+		const std::string &message)
+{
+	this->m_failures++;
+
+	report << lineNo << ";ERROR;" << message << '\n';
+}
+
+StudentRecord BatchCommandRunner::parseStudent(const std::vector<std::string> &command)
+{
+	if(command.size() != 8)
+	{
+		throw invalid_argument("student needs 7 fields");
+	}
+
+	StudentRecord record;
+
+	record.firstName = command[1];
+	record.lastName = command[2];
+
+	//! dd.mm.yyyy, also d.m.yyyy, read without a regex.
+	string date = command[3];
+
+	int day = stoi(splitAt(date, '.'));
+	int month = stoi(splitAt(date, '.'));
+	int year = stoi(date);
+
+	if(day < 1 || day > 31 || month < 1 || month > 12)
+	{
+		throw invalid_argument("invalid date of birth " + command[3]);
+	}
+
+	record.dateOfBirth = Poco::Data::Date(year, month, day);
+	record.street = command[4];
+	record.postalCode = stoul(command[5]);
+	record.cityName = command[6];
+	record.additionalInfo = command[7];
+
+	return record;
+}
+
+void BatchCommandRunner::flushStudents(std::ostream &report)
+{
+	if(this->m_students.empty())
+	{
+		return;
+	}
+
+	vector<unsigned int> matrikelNumbers;
+
+	this->m_db.addStudentsBatch(move(this->m_students), matrikelNumbers);
+
+	for(size_t studentIdx = 0; studentIdx < matrikelNumbers.size(); studentIdx++)
+	{
+		if(matrikelNumbers[studentIdx] == 0)
+		{
+			this->reportResult(report, this->m_studentLines[studentIdx],
+					StudentDb::RC_StudentDb_t::RC_Student_Exists);
+		}
+		else
+		{
+			report << this->m_studentLines[studentIdx] << ';'
+					<< resultName(StudentDb::RC_StudentDb_t::RC_Success) << ';'
+					<< matrikelNumbers[studentIdx] << '\n';
+		}
+	}
+
+	this->m_students.clear();
+	this->m_studentLines.clear();
+}
+
+void BatchCommandRunner::executeCommand(std::vector<std::string> &command,
+		unsigned int lineNo, std::ostream &report)
+{
+	const string& name = command[0];
+
+	if(name == "student")
+	{
+		this->m_students.push_back(parseStudent(command));
+		this->m_studentLines.push_back(lineNo);
+
+		if(this->m_students.size() >= this->m_batchSize)
+		{
+			this->flushStudents(report);
+		}
+
+		return;
+	}
+
+	//! The students before the command may be enrolled by it.
+	this->flushStudents(report);
+
+	StudentDb::RC_StudentDb_t result;
+
+	if(name == "course" && command.size() == 11 && (command[6] == "B" || command[6] == "b"))
+	{
+		string noDayOfWeek;
+
+		result = this->m_db.addNewCourse(command[1], command[2], command[3], command[4],
+				command[5], command[6], command[7], command[8], command[9], command[10],
+				noDayOfWeek);
+	}
+	else if(name == "course" && command.size() == 10 && (command[6] == "W" || command[6] == "w"))
+	{
+		string noDate;
+
+		result = this->m_db.addNewCourse(command[1], command[2], command[3], command[4],
+				command[5], command[6], command[7], command[8], noDate, noDate,
+				command[9]);
+	}
+	else if(name == "enroll" && command.size() == 4)
+	{
+		result = this->m_db.addEnrollment(command[1], command[3], command[2]);
+	}
+	else if(name == "grade" && command.size() == 4)
+	{
+		result = this->m_db.updateGrade(stoul(command[2]), stof(command[3]), stoul(command[1]));
+	}
+	else if(name == "unenroll" && command.size() == 3)
+	{
+		result = this->m_db.deleteEnrollment(stoul(command[2]), stoul(command[1]));
+	}
+	else if(name == "save" && command.size() == 2)
+	{
+		this->m_db.saveToFile(command[1]);
+
+		result = StudentDb::RC_StudentDb_t::RC_Success;
+	}
+	else
+	{
+		throw invalid_argument("unknown command or wrong number of fields");
+	}
+
+	this->reportResult(report, lineNo, result);
+}
+
+unsigned int BatchCommandRunner::run(std::istream &commands, std::ostream &report)
+{
+	this->m_noOfCommands = 0;
+	this->m_failures = 0;
+
+	string line;
+
+	unsigned int lineNo = 0;
+
+	while(getline(commands, line))
+	{
+		lineNo++;
+
+		if(!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		if(line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+
+		this->m_noOfCommands++;
+
+		vector<string> command = splitFields(line);
+
+		try
+		{
+			this->executeCommand(command, lineNo, report);
+		}
+		catch(const exception& error)
+		{
+			//! The buffered students come first in the file.
+			this->flushStudents(report);
+
+			this->reportError(report, lineNo, error.what());
+		}
+	}
+
+	this->flushStudents(report);
+
+	return this->m_failures;
+}
+
+unsigned int BatchCommandRunner::getNoOfCommands() const
+{
+	return this->m_noOfCommands;
+}
@@ -0,0 +1,144 @@
+/*!
+ * @file BatchCommandRunner.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef BATCHCOMMANDRUNNER_H_
+#define BATCHCOMMANDRUNNER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "StudentDb.h"
+
+/*!
+ * @class BatchCommandRunner
+ * @brief Executes a command file against a StudentDb without any prompts.
+ *
+ * Every line holds one command, its fields separated by ';' like in the
+ * database file. Empty lines and lines starting with '#' are skipped.
+ *
+ * 		course;key;title;major;credits;semester;B;startTime;endTime;startDate;endDate
+ * 		course;key;title;major;credits;semester;W;startTime;endTime;dayOfWeek
+ * 		student;firstName;lastName;dd.mm.yyyy;street;postalCode;city;additionalInfo
+ * 		enroll;matrikelNumber;courseKey;semester
+ * 		grade;matrikelNumber;courseKey;grade
+ * 		unenroll;matrikelNumber;courseKey
+ * 		save;fileName
+ *
+ * Consecutive students are collected and added with one call of
+ * StudentDb::addStudentsBatch(), all other commands are executed
+ * directly. The pending students are added before any other command,
+ * so the commands take effect in the order of the file.
+ *
+ * For every command one report line is written, in the order of the
+ * file: "lineNo;RC_Name", with the matrikel number of an added student
+ * appended, or "lineNo;ERROR;message" if the line could not be parsed.
+ */
+class BatchCommandRunner
+{
+private:
+	/*!
+	 * @var m_db - The database the commands are executed against.
+	 */
+	StudentDb& m_db;
+
+	/*!
+	 * @var m_batchSize - Maximum number of students added at a time.
+	 */
+	unsigned int m_batchSize;
+
+	/*!
+	 * @var m_students - The students not yet added.
+	 */
+	std::vector<StudentRecord> m_students;
+
+	/*!
+	 * @var m_studentLines - The line number of every student not yet added.
+	 */
+	std::vector<unsigned int> m_studentLines;
+
+	/*!
+	 * @var m_noOfCommands - Number of commands of the current run.
+	 */
+	unsigned int m_noOfCommands;
+
+	/*!
+	 * @var m_failures - Number of commands that failed in the current run.
+	 */
+	unsigned int m_failures;
+
+	/*!
+	 * @brief Executes one command or, for a student, adds it to the batch.
+	 *
+	 * @param command The fields of the command line.
+	 * @param lineNo The line number for the report.
+	 * @param report The stream receiving the report line.
+	 */
+	void executeCommand(std::vector<std::string>& command, unsigned int lineNo,
+			std::ostream& report);
+
+	/*!
+	 * @brief Adds the pending students and reports their results.
+	 */
+	void flushStudents(std::ostream& report);
+
+	/*!
+	 * @brief Parses the fields of a student command into a record.
+	 *
+	 * @throws std::invalid_argument if a field is invalid.
+	 */
+	static StudentRecord parseStudent(const std::vector<std::string>& command);
+
+	/*!
+	 * @brief Writes a report line with the result of a command.
+	 */
+	void reportResult(std::ostream& report, unsigned int lineNo,
+			StudentDb::RC_StudentDb_t result);
+
+	/*!
+	 * @brief Writes a report line for a command that could not be executed.
+	 */
+	void reportError(std::ostream& report, unsigned int lineNo,
+			const std::string& message);
+
+public:
+	/*!
+	 * @brief Constructor.
+	 *
+	 * @param db The database the commands are executed against.
+	 * @param batchSize Maximum number of students added at a time.
+	 */
+	BatchCommandRunner(StudentDb& db, unsigned int batchSize = 1024);
+
+	/*!
+	 * @brief Executes all commands of a command file.
+	 *
+	 * @param commands The command file.
+	 * @param report The stream receiving one report line per command.
+	 * @return Number of commands that failed.
+	 */
+	unsigned int run(std::istream& commands, std::ostream& report);
+
+	/*!
+	 * @brief Returns the name of a result code, as used in the report.
+	 */
+	static std::string resultName(StudentDb::RC_StudentDb_t result);
+
+	/*!
+	 * @brief Splits a line at every ';', without a regex.
+	 */
+	static std::vector<std::string> splitFields(const std::string& line);
+
+	/*!
+	 * @brief Getter method for the number of commands of the last run.
+	 */
+	unsigned int getNoOfCommands() const;
+};
+
+#endif /* BATCHCOMMANDRUNNER_H_ */
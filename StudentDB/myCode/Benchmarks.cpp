@@ -0,0 +1,512 @@
+/*!
+ * @file Benchmarks.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "Benchmarks.h"
+
+#include <chrono>
+
+#include "StudentDb.h"
+#include "GeneratorServer.h"
+#include "ServerRecordScanner.h"
+#include "IngestionMetrics.h"
+#include "QueryServer.h"
+#include "QueryClient.h"
+
+using namespace std;
+
+/*!
+ * @brief A student as written by Student::toJson().
+ */
+static const string sampleStudentJson =
+		R"({"address":{"additionalInfo":"Apartement 10b","cityName":"Darmstadt",)"
+		R"("postalCode":64287,"street":"2575 Am Karlshof"},"dateOfBirth":"01.03.1997",)"
+		R"("enrollments":[],"firstName":"Girish","lastName":"Tabaraddi","matrikelNumber":100001})";
+
+/*!
+ * @brief A response line of the generator server.
+ */
+static const string sampleServerJson =
+		R"({"name":{"title":"Mr","firstName":"Tobias","lastName":"Müller"},)"
+		R"("location":{"street":"Hauptstraße 12","postCode":64295,)"
+		R"("city":"Darmstadt","state":"Hessen"},)"
+		R"("dateOfBirth":{"year":97,"month":2,"date":31},"email":"tobias@example.com"})";
+
+/*!
+ * @brief Runs func noOfRecords times and returns the average time per call.
+ */
+template<typename Func>
+static double nanosecondsPerRecord(unsigned int noOfRecords, Func func)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	for(unsigned int idx = 0; idx < noOfRecords; idx++)
+	{
+		func();
+	}
+
+	chrono::nanoseconds elapsed = chrono::steady_clock::now() - start;
+
+	return static_cast<double>(elapsed.count()) / max(noOfRecords, 1u);
+}
+
+/*!
+ * @brief The former Student::fromJson, extracting through DynamicStruct copies.
+ */
+static Student legacyStudentFromJson(Poco::JSON::Object::Ptr data)
+{
+	Poco::DynamicStruct jsonDataStruct = *data;
+
+	string firstName = jsonDataStruct["firstName"].toString();
+	string lastName = jsonDataStruct["lastName"].toString();
+	Poco::Data::Date dateOfBirth =
+			stringToPocoDateFormatter(jsonDataStruct["dateOfBirth"].toString());
+	unsigned int matrikelNumber = jsonDataStruct["matrikelNumber"];
+
+	Poco::DynamicStruct addressStruct = *(data->getObject("address"));
+
+	string street = addressStruct["street"].toString();
+	unsigned int postalCode = addressStruct["postalCode"];
+	string city = addressStruct["cityName"].toString();
+	string additionalInfo = addressStruct["additionalInfo"].toString();
+
+	return Student(matrikelNumber, firstName, lastName, dateOfBirth,
+			make_shared<Address>(street, postalCode, city, additionalInfo));
+}
+
+/*!
+ * @brief The former extraction of parsingJSONData, converting every field
+ * twice through nested DynamicStruct lookups.
+ */
+static bool legacyExtractServerRecord(Poco::JSON::Object::Ptr data,
+		StudentRecord& record)
+{
+	Poco::DynamicStruct JSONDataStruct = *data;
+
+	auto isValid = [](const string& eachStr)
+	{
+		return all_of(eachStr.begin(), eachStr.end(), ::isprint);
+	};
+
+	if(isValid(JSONDataStruct["name"]["firstName"].toString()) &&
+			isValid(JSONDataStruct["name"]["lastName"].toString()) &&
+			isValid(JSONDataStruct["dateOfBirth"]["year"].toString()) &&
+			isValid(JSONDataStruct["dateOfBirth"]["month"].toString()) &&
+			isValid(JSONDataStruct["dateOfBirth"]["date"].toString()) &&
+			isValid(JSONDataStruct["location"]["street"].toString()) &&
+			isValid(JSONDataStruct["location"]["postCode"].toString()) &&
+			isValid(JSONDataStruct["location"]["city"].toString()) &&
+			isValid(JSONDataStruct["location"]["state"].toString()))
+	{
+		record.firstName = Poco::UTF8::unescape(JSONDataStruct["name"]["firstName"].toString());
+		record.lastName = Poco::UTF8::unescape(JSONDataStruct["name"]["lastName"].toString());
+		int year = JSONDataStruct["dateOfBirth"]["year"].convert<int>()+1900;
+		int month = JSONDataStruct["dateOfBirth"]["month"].convert<int>()+1;
+		int day = JSONDataStruct["dateOfBirth"]["date"].convert<int>();
+		record.dateOfBirth = Poco::Data::Date(year, month, day);
+
+		record.street = Poco::UTF8::unescape(JSONDataStruct["location"]["street"].toString());
+		record.postalCode = JSONDataStruct["location"]["postCode"].convert<int>();
+		record.cityName = Poco::UTF8::unescape(JSONDataStruct["location"]["city"].toString());
+		record.additionalInfo = Poco::UTF8::unescape(JSONDataStruct["location"]["state"].toString());
+
+		return true;
+	}
+
+	return false;
+}
+
+/*!
+ * @brief Fills db with noOfStudents generated students, each enrolled
+ * in one of a few courses, through the text format reader.
+ */
+static void populateSampleDb(StudentDb& db, unsigned int noOfStudents)
+{
+	const unsigned int noOfCourses = 4;
+	const unsigned int firstMatrikel = 100000;
+
+	ostringstream text;
+
+	text << noOfCourses << endl;
+
+	for(unsigned int courseIdx = 0; courseIdx < noOfCourses; courseIdx++)
+	{
+		text << "W;" << 1000 + courseIdx << ";Course " << courseIdx
+				<< ";Automation;5.0;WiSe2021;" << courseIdx + 1 << ";08:30;10:00" << endl;
+	}
+
+	text << noOfStudents << endl;
+
+	for(unsigned int idx = 0; idx < noOfStudents; idx++)
+	{
+		text << firstMatrikel + idx << ";First" << idx << ";Last" << idx
+				<< ";01.03.1997;" << idx << " Am Karlshof;64287;Darmstadt;Apartement 10b" << endl;
+	}
+
+	text << noOfStudents << endl;
+
+	for(unsigned int idx = 0; idx < noOfStudents; idx++)
+	{
+		text << firstMatrikel + idx << ";" << 1000 + idx % noOfCourses
+				<< ";WiSe2021;" << 1.0 + idx % 4 << ".0" << endl;
+	}
+
+	istringstream in(text.str());
+
+	db.read(in);
+}
+
+bool runBenchmark(const std::string &name, unsigned int noOfRecords,
+		std::ostream &out)
+{
+	if(name == "json-extraction")
+	{
+		benchmarkJsonExtraction(noOfRecords, out);
+	}
+	else if(name == "json-export")
+	{
+		benchmarkJsonExport(noOfRecords, out);
+	}
+	else if(name == "ingestion")
+	{
+		benchmarkIngestion(noOfRecords, out);
+	}
+	else if(name == "replay")
+	{
+		benchmarkReplay(noOfRecords, out);
+	}
+	else if(name == "server-records")
+	{
+		benchmarkServerRecords(noOfRecords, out);
+	}
+	else if(name == "query-server")
+	{
+		benchmarkQueryServer(noOfRecords, out);
+	}
+	else
+	{
+		out << "Unknown benchmark: " << name << endl;
+		out << "Available benchmarks: json-extraction, json-export, ingestion, replay, "
+				"server-records, query-server" << endl;
+
+		return false;
+	}
+
+	return true;
+}
+
+void benchmarkJsonExtraction(unsigned int noOfRecords, std::ostream &out)
+{
+	Poco::JSON::Parser parser;
+
+	Poco::JSON::Object::Ptr studentData =
+			parser.parse(sampleStudentJson).extract<Poco::JSON::Object::Ptr>();
+
+	parser.reset();
+
+	Poco::JSON::Object::Ptr serverData =
+			parser.parse(sampleServerJson).extract<Poco::JSON::Object::Ptr>();
+
+	//! Keeps the results alive, so the loops can't be optimized away.
+	unsigned long checksum = 0;
+
+	double legacyStudent = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		checksum += legacyStudentFromJson(studentData).getMatrikelNumber();
+	});
+
+	double typedStudent = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		checksum += Student::fromJson(studentData).getMatrikelNumber();
+	});
+
+	double legacyServer = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		StudentRecord record;
+		checksum += legacyExtractServerRecord(serverData, record) ? record.postalCode : 0;
+	});
+
+	double typedServer = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		StudentRecord record;
+		checksum += StudentDb::extractServerRecord(*serverData, record) ? record.postalCode : 0;
+	});
+
+	out << "JSON field extraction, " << noOfRecords << " records each" << endl;
+	out << fixed << setprecision(1);
+	out << "\t Student::fromJson      DynamicStruct: " << legacyStudent
+			<< " ns/record, typed: " << typedStudent << " ns/record" << endl;
+	out << "\t Server record          DynamicStruct: " << legacyServer
+			<< " ns/record, typed: " << typedServer << " ns/record" << endl;
+	out << "\t (checksum " << checksum << ")" << endl;
+}
+
+void benchmarkJsonExport(unsigned int noOfRecords, std::ostream &out)
+{
+	StudentDb db;
+
+	populateSampleDb(db, noOfRecords);
+
+	string sequentialJson, parallelJson;
+
+	double sequential = nanosecondsPerRecord(1, [&]()
+	{
+		ostringstream jsonStream;
+		db.writeJson(jsonStream, 1);
+		sequentialJson = jsonStream.str();
+	});
+
+	double parallel = nanosecondsPerRecord(1, [&]()
+	{
+		ostringstream jsonStream;
+		db.writeJson(jsonStream);
+		parallelJson = jsonStream.str();
+	});
+
+	unsigned int noOfStudents = max<size_t>(db.getNoOfStudents(), 1);
+
+	out << "JSON export, " << db.getNoOfStudents() << " students, "
+			<< thread::hardware_concurrency() << " hardware threads" << endl;
+	out << fixed << setprecision(1);
+	out << "\t sequential: " << sequential / noOfStudents
+			<< " ns/student, parallel: " << parallel / noOfStudents << " ns/student" << endl;
+	out << "\t output " << ((sequentialJson == parallelJson) ? "identical" : "DIFFERS")
+			<< " (" << sequentialJson.size() << " bytes)" << endl;
+}
+
+void benchmarkIngestion(unsigned int noOfRecords, std::ostream &out)
+{
+	GeneratorServer server(0, 42);
+
+	vector<pair<string, double>> results;
+
+	auto measure = [&](const string& mode, unsigned int noOfUserData,
+			const function<void(StudentDb&, unsigned int)>& fetch)
+	{
+		StudentDb db;
+
+		db.setServerEndpoint("127.0.0.1", server.getPort());
+
+		double nanoseconds = nanosecondsPerRecord(1, [&]() { fetch(db, noOfUserData); });
+
+		results.push_back(make_pair(mode + ", " + to_string(db.getNoOfStudents())
+				+ " of " + to_string(noOfUserData) + " added",
+				noOfUserData / max(nanoseconds / 1e9, 1e-9)));
+	};
+
+	measure("connection per record", min(noOfRecords, 200u), [](StudentDb& db, unsigned int count)
+			{ db.readStudentDataFromServer(count); });
+	measure("pipelined", noOfRecords, [](StudentDb& db, unsigned int count)
+			{ db.readStudentDataFromServerPipelined(count); });
+	measure("parallel, 4 connections", noOfRecords, [](StudentDb& db, unsigned int count)
+			{ db.readStudentDataFromServerParallel(count, cout, 4); });
+	measure("asynchronous, 16 connections", noOfRecords, [](StudentDb& db, unsigned int count)
+			{ db.readStudentDataFromServerAsync(count, cout, 16); });
+	measure("staged pipeline", noOfRecords, [](StudentDb& db, unsigned int count)
+			{ db.readStudentDataFromServerStaged(count); });
+
+	out << "Server ingestion from a local generator on port " << server.getPort() << endl;
+	out << fixed << setprecision(0);
+
+	for(const pair<string, double>& result : results)
+	{
+		out << "\t " << result.first << ": " << result.second << " records/s" << endl;
+	}
+}
+
+void benchmarkReplay(unsigned int noOfRecords, std::ostream &out)
+{
+	ostringstream capture;
+
+	GeneratorServer::writeResponses(capture, noOfRecords, 42);
+
+	istringstream in(capture.str());
+
+	StudentDb db;
+
+	double nanoseconds = nanosecondsPerRecord(1, [&]() { db.replayServerData(in); });
+
+	out << "Replay of " << noOfRecords << " captured responses" << endl;
+	out << fixed << setprecision(1);
+	out << "\t total: " << nanoseconds / max(noOfRecords, 1u) << " ns/response, "
+			<< db.getNoOfStudents() << " students added" << endl;
+}
+
+void benchmarkServerRecords(unsigned int noOfRecords, std::ostream &out)
+{
+	mt19937 random(42);
+
+	vector<string> lines;
+
+	lines.reserve(noOfRecords);
+
+	for(unsigned int idx = 0; idx < noOfRecords; idx++)
+	{
+		lines.push_back(GeneratorServer::generateRecord(random));
+
+		//! Some broken lines, to include the malformed path.
+		if(idx % 16 == 15)
+		{
+			lines.back().resize(lines.back().size() / 2);
+		}
+	}
+
+	unsigned int valid[2] = {0, 0}, rejected[2] = {0, 0}, malformed[2] = {0, 0};
+
+	Poco::JSON::Parser parser;
+
+	size_t lineIdx = 0;
+
+	double parsed = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		StudentRecord record;
+
+		try
+		{
+			parser.reset();
+
+			Poco::Dynamic::Var parsedJSONData = parser.parse(lines[lineIdx++]);
+
+			(StudentDb::extractServerRecord(*(parsedJSONData.extract<Poco::JSON::Object::Ptr>()),
+					record) ? valid : rejected)[0]++;
+		}
+		catch(const Poco::Exception&)
+		{
+			malformed[0]++;
+		}
+	});
+
+	lineIdx = 0;
+
+	double scanned = nanosecondsPerRecord(noOfRecords, [&]()
+	{
+		StudentRecord record;
+
+		switch(ServerRecordScanner::scan(lines[lineIdx++], record))
+		{
+		case ServerRecordScanner::ScanResult_t::SR_Valid: valid[1]++; break;
+		case ServerRecordScanner::ScanResult_t::SR_Rejected: rejected[1]++; break;
+		case ServerRecordScanner::ScanResult_t::SR_Malformed: malformed[1]++; break;
+		}
+	});
+
+	auto recordsPerSecond = [](double nanoseconds)
+	{
+		return 1e9 / max(nanoseconds, 1e-3);
+	};
+
+	out << "Server record extraction, " << noOfRecords << " response lines" << endl;
+	out << fixed << setprecision(0);
+	out << "\t parse and extractServerRecord: " << recordsPerSecond(parsed) << " records/s, "
+			<< valid[0] << " valid, " << rejected[0] << " rejected, "
+			<< malformed[0] << " malformed" << endl;
+	out << "\t ServerRecordScanner:           " << recordsPerSecond(scanned) << " records/s, "
+			<< valid[1] << " valid, " << rejected[1] << " rejected, "
+			<< malformed[1] << " malformed" << endl;
+}
+
+void benchmarkQueryServer(unsigned int noOfRecords, std::ostream &out)
+{
+	const unsigned int noOfClients = 16;
+	const unsigned int requestsPerClient = 2000;
+
+	StudentDb db;
+
+	populateSampleDb(db, max(noOfRecords, 1u));
+
+	QueryServer server(db, "127.0.0.1", 0, noOfClients);
+
+	//! Lookups, searches and rosters, enrollment changes.
+	array<LatencyHistogram, 3> latencies;
+
+	vector<thread> clients;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	for(unsigned int clientIdx = 0; clientIdx < noOfClients; clientIdx++)
+	{
+		clients.emplace_back([&, clientIdx]()
+		{
+			QueryClient client("127.0.0.1", server.getPort());
+
+			mt19937 random(clientIdx);
+
+			uniform_int_distribution<unsigned int> student(0, max(noOfRecords, 1u) - 1);
+
+			for(unsigned int requestIdx = 0; requestIdx < requestsPerClient; requestIdx++)
+			{
+				unsigned int studentIdx = student(random);
+				unsigned int matrikelNumber = 100000 + studentIdx;
+
+				string request;
+				unsigned int kind = 0;
+
+				if(requestIdx % 200 == 0)
+				{
+					request = "find;Last" + to_string(studentIdx);
+					kind = 1;
+				}
+				else if(requestIdx % 200 == 100)
+				{
+					request = "roster;" + to_string(1000 + studentIdx % 4);
+					kind = 1;
+				}
+				else if(requestIdx % 10 == 5)
+				{
+					request = "enroll;" + to_string(matrikelNumber) + ";"
+							+ to_string(1000 + (studentIdx + 1) % 4) + ";SoSe2022";
+					kind = 2;
+				}
+				else if(requestIdx % 10 == 6)
+				{
+					request = "grade;" + to_string(matrikelNumber) + ";"
+							+ to_string(1000 + studentIdx % 4) + ";1.7";
+					kind = 2;
+				}
+				else
+				{
+					request = "get;" + to_string(matrikelNumber);
+				}
+
+				chrono::steady_clock::time_point sent = chrono::steady_clock::now();
+
+				client.request(request);
+
+				latencies[kind].record(chrono::steady_clock::now() - sent);
+			}
+		});
+	}
+
+	for(thread& client : clients)
+	{
+		client.join();
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	out << "Query server, " << db.getNoOfStudents() << " students, " << noOfClients
+			<< " clients with " << requestsPerClient << " requests each" << endl;
+	out << fixed << setprecision(0);
+	out << "\t throughput: " << noOfClients * requestsPerClient / max(seconds, 1e-9)
+			<< " requests/s" << endl;
+
+	const array<string, 3> kinds = {"lookups", "searches and rosters", "enrollment changes"};
+
+	out << setprecision(1);
+
+	for(size_t kindIdx = 0; kindIdx < kinds.size(); kindIdx++)
+	{
+		const LatencyHistogram& histogram = latencies[kindIdx];
+
+		out << "\t " << kinds[kindIdx] << " (" << histogram.getCount() << "): p50 "
+				<< histogram.percentileNs(0.5) / 1e3 << " us, p99 "
+				<< histogram.percentileNs(0.99) / 1e3 << " us, p99.9 "
+				<< histogram.percentileNs(0.999) / 1e3 << " us, max "
+				<< histogram.getMaxNs() / 1e3 << " us" << endl;
+	}
+}
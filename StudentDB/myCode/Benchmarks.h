@@ -0,0 +1,104 @@
+/*!
+ * @file Benchmarks.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef BENCHMARKS_H_
+#define BENCHMARKS_H_
+
+#include <iostream>
+#include <string>
+
+/*!
+ * @brief Runs the benchmark with the given name.
+ *
+ * Started from main with "--benchmark <name> [noOfRecords]".
+ * Prints the list of available benchmarks if the name is unknown.
+ *
+ * @param name The name of the benchmark to be run.
+ * @param noOfRecords Number of records processed by the benchmark.
+ * @param out The output stream for the results.
+ * @return True if the benchmark exists and was run, false otherwise.
+ */
+bool runBenchmark(const std::string& name, unsigned int noOfRecords,
+		std::ostream& out);
+
+/*!
+ * @brief Measures the per record cost of the JSON field extraction.
+ *
+ * Compares Student::fromJson and StudentDb::extractServerRecord with
+ * the former extraction through Poco::DynamicStruct copies, on records
+ * that have already been parsed.
+ *
+ * @param noOfRecords Number of records extracted by every variant.
+ * @param out The output stream for the results.
+ */
+void benchmarkJsonExtraction(unsigned int noOfRecords, std::ostream& out);
+
+/*!
+ * @brief Measures the sequential and the parallel JSON export.
+ *
+ * Fills a database with noOfRecords students and writes it with
+ * StudentDb::writeJson on one thread and on all hardware threads,
+ * and checks that both outputs are byte-identical.
+ *
+ * @param noOfRecords Number of students in the database.
+ * @param out The output stream for the results.
+ */
+void benchmarkJsonExport(unsigned int noOfRecords, std::ostream& out);
+
+/*!
+ * @brief Measures the server ingestion modes against a local GeneratorServer.
+ *
+ * Fetches noOfRecords students with the pipelined, the parallel, the
+ * asynchronous and the staged mode, and at most 200 students with a
+ * connection per record.
+ *
+ * @param noOfRecords Number of students fetched by every mode.
+ * @param out The output stream for the results.
+ */
+void benchmarkIngestion(unsigned int noOfRecords, std::ostream& out);
+
+/*!
+ * @brief Measures the ingestion of server responses without the network.
+ *
+ * Replays noOfRecords responses written by GeneratorServer::writeResponses
+ * with StudentDb::replayServerData, which reports the time of parsing,
+ * extraction and insertion separately.
+ *
+ * @param noOfRecords Number of replayed responses.
+ * @param out The output stream for the results.
+ */
+void benchmarkReplay(unsigned int noOfRecords, std::ostream& out);
+
+/*!
+ * @brief Measures the extraction of server records in records per second.
+ *
+ * Compares parsing into a Poco::JSON::Object followed by
+ * StudentDb::extractServerRecord with ServerRecordScanner::scan on
+ * noOfRecords generated response lines, every 16th of them truncated.
+ *
+ * @param noOfRecords Number of response lines.
+ * @param out The output stream for the results.
+ */
+void benchmarkServerRecords(unsigned int noOfRecords, std::ostream& out);
+
+/*!
+ * @brief Measures the latency of a QueryServer under load.
+ *
+ * Serves a database of noOfRecords students on a local QueryServer and
+ * lets several clients send a mix of lookups, name searches, rosters
+ * and enrollment changes at the same time, each client on its own
+ * connection. Reports the throughput and the latency percentiles of
+ * every kind of request.
+ *
+ * @param noOfRecords Number of students in the served database.
+ * @param out The output stream for the results.
+ */
+void benchmarkQueryServer(unsigned int noOfRecords, std::ostream& out);
+
+#endif /* BENCHMARKS_H_ */
@@ -9,6 +9,8 @@
 
 #include "BlockCourse.h"
 
+#include "ModelFields.h"
+
 using namespace std;
 
 BlockCourse::BlockCourse(unsigned int courseKey, std::string title,
@@ -48,13 +50,9 @@ void BlockCourse::write(std::ostream &out) const
 {
 	out << "B;";
 
-	Course::write(out);
+	writeFieldsText(out, *this, blockCourseFields());
 
-	out << ";" << datetoString(this->m_startDate)
-	    				<< ";" << datetoString(this->m_endDate)
-						<< ";" << timetoString(this->m_startTime)
-						<< ";" << timetoString(this->m_endTime)
-						<< endl;
+	out << endl;
 }
 
 std::unique_ptr<BlockCourse> BlockCourse::read(std::istream &in)
@@ -63,40 +61,42 @@ std::unique_ptr<BlockCourse> BlockCourse::read(std::istream &in)
 
 	getline(in, inStr);
 
-	string courseKey = splitAt(inStr, ';');
-	string title = splitAt(inStr, ';');
-	string major = splitAt(inStr, ';');
-	string creditPoints = splitAt(inStr, ';');
-    string semester = splitAt(inStr, ';');
-	string startDate = splitAt(inStr, ';');
-	string endDate = splitAt(inStr, ';');
-	string startTime = splitAt(inStr, ';');
-	string endTime = splitAt(inStr, '\n');
-
-	return make_unique<BlockCourse>(stoi(courseKey), title, major, stof(creditPoints), semester,
-			dateFromString(startDate), dateFromString(endDate),
-			timeFromString(startTime), timeFromString(endTime));
+	auto values = readFieldsText(inStr, blockCourseFields());
+
+	return applyValues([](auto&&... fields)
+			{ return make_unique<BlockCourse>(forward<decltype(fields)>(fields)...); }, values);
 }
 
 Poco::JSON::Object::Ptr BlockCourse::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	Poco::JSON::Object::Ptr courseJSON = Course::toJson();
+	returnObj->set("courseType", "B");
 
-	Poco::Dynamic::Var courseType = Poco::Dynamic::Var("B");
+	writeFieldsJson(*returnObj, *this, blockCourseFields());
 
-	returnObj->set("courseType", courseType);
+	return returnObj;
+}
 
-	for(const string& key: courseJSON->getNames())
-	{
-		returnObj->set(key, courseJSON->get(key));
-	}
+std::unique_ptr<BlockCourse> BlockCourse::fromJson(Poco::JSON::Object::Ptr data)
+{
+	auto values = readFieldsJson(*data, blockCourseFields());
 
-	returnObj->set("startDate", datetoString(this->m_startDate));
-	returnObj->set("endDate", datetoString(this->m_endDate));
-	returnObj->set("startTime", timetoString(this->m_startTime));
-	returnObj->set("endTime", timetoString(this->m_endTime));
+	return applyValues([](auto&&... fields)
+			{ return make_unique<BlockCourse>(forward<decltype(fields)>(fields)...); }, values);
+}
 
-	return returnObj;
+void BlockCourse::writeBinary(std::ostream &out) const
+{
+	writeLittleEndian<uint8_t>(out, 'B');
+
+	writeFieldsBinary(out, *this, blockCourseFields());
+}
+
+std::unique_ptr<BlockCourse> BlockCourse::readBinary(std::istream &in)
+{
+	auto values = readFieldsBinary(in, blockCourseFields());
+
+	return applyValues([](auto&&... fields)
+			{ return make_unique<BlockCourse>(forward<decltype(fields)>(fields)...); }, values);
 }
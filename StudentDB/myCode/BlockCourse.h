@@ -127,6 +127,32 @@ public:
 	 * @override
 	 */
 	Poco::JSON::Object::Ptr toJson() const override;
+
+	/*!
+	 * @brief Creates a BlockCourse object from JSON data.
+	 *
+	 * @param data A pointer to the Poco::JSON::Object containing JSON data.
+	 * @return A unique pointer to the constructed BlockCourse object.
+	 * @throws Poco::NotFoundException if a member is missing.
+	 */
+	static std::unique_ptr<BlockCourse> fromJson(Poco::JSON::Object::Ptr data);
+
+	/*!
+	 * @brief Write the object's data in the binary format,
+	 * preceded by the type tag 'B'.
+	 *
+	 * @param out The output stream where the object's data will be written.
+	 */
+	void writeBinary(std::ostream& out) const override;
+
+	/*!
+	 * @brief Reads a BlockCourse written by writeBinary(), after the type tag.
+	 *
+	 * @param in The input stream from which to read the BlockCourse.
+	 * @return A unique pointer to the constructed BlockCourse object.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static std::unique_ptr<BlockCourse> readBinary(std::istream& in);
 };
 
 #endif /* BLOCKCOURSE_H_ */
@@ -0,0 +1,200 @@
+/*!
+ * @file BoundedQueue.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef BOUNDEDQUEUE_H_
+#define BOUNDEDQUEUE_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+/*!
+ * @class BoundedQueue
+ * @brief A blocking first in first out queue with a fixed capacity,
+ * shared by producer threads and consumer threads.
+ *
+ * push() blocks while the queue is full, pop() blocks while the queue
+ * is empty. Once close() has been called, pop() drains the remaining
+ * elements and then returns false.
+ */
+template<typename T>
+class BoundedQueue
+{
+private:
+	/*!
+	 * @var m_capacity - Maximum number of queued elements.
+	 */
+	const std::size_t m_capacity;
+
+	/*!
+	 * @var m_elements - The queued elements.
+	 */
+	std::deque<T> m_elements;
+
+	/*!
+	 * @var m_closed - True once no more elements will be pushed.
+	 */
+	bool m_closed;
+
+	/*!
+	 * @var m_mutex - Guards the elements and the closed flag.
+	 */
+	std::mutex m_mutex;
+
+	/*!
+	 * @var m_notFull - Signaled when an element has been removed.
+	 */
+	std::condition_variable m_notFull;
+
+	/*!
+	 * @var m_notEmpty - Signaled when an element has been appended.
+	 */
+	std::condition_variable m_notEmpty;
+
+public:
+	/*!
+	 * @brief Constructor of an empty queue.
+	 *
+	 * @param capacity Maximum number of queued elements, at least 1.
+	 */
+	explicit BoundedQueue(std::size_t capacity) :
+		m_capacity(std::max<std::size_t>(capacity, 1)), m_closed(false)
+	{
+	}
+
+	/*!
+	 * @brief Appends an element, waits while the queue is full.
+	 *
+	 * @param element The element to be appended.
+	 * @return False if the queue has been closed, the element is dropped.
+	 */
+	bool push(T element)
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+
+		this->m_notFull.wait(lock, [this]()
+				{ return this->m_closed || this->m_elements.size() < this->m_capacity; });
+
+		if(this->m_closed)
+		{
+			return false;
+		}
+
+		this->m_elements.push_back(std::move(element));
+
+		lock.unlock();
+
+		this->m_notEmpty.notify_one();
+
+		return true;
+	}
+
+	/*!
+	 * @brief Appends an element if the queue has room, without waiting.
+	 *
+	 * @param element The element, moved into the queue on success.
+	 * @return False if the queue is full or closed, the element is kept.
+	 */
+	bool tryPush(T& element)
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+
+		if(this->m_closed || this->m_elements.size() >= this->m_capacity)
+		{
+			return false;
+		}
+
+		this->m_elements.push_back(std::move(element));
+
+		lock.unlock();
+
+		this->m_notEmpty.notify_one();
+
+		return true;
+	}
+
+	/*!
+	 * @brief Removes the oldest element, waits while the queue is empty.
+	 *
+	 * @param element Receives the removed element.
+	 * @return False if the queue is closed and empty.
+	 */
+	bool pop(T& element)
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+
+		this->m_notEmpty.wait(lock, [this]()
+				{ return this->m_closed || !this->m_elements.empty(); });
+
+		if(this->m_elements.empty())
+		{
+			return false;
+		}
+
+		element = std::move(this->m_elements.front());
+
+		this->m_elements.pop_front();
+
+		lock.unlock();
+
+		this->m_notFull.notify_one();
+
+		return true;
+	}
+
+	/*!
+	 * @brief Removes all queued elements, waits while the queue is empty.
+	 *
+	 * @param elements Receives the removed elements, appended in order.
+	 * @return False if the queue is closed and empty.
+	 */
+	bool popAll(std::vector<T>& elements)
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+
+		this->m_notEmpty.wait(lock, [this]()
+				{ return this->m_closed || !this->m_elements.empty(); });
+
+		if(this->m_elements.empty())
+		{
+			return false;
+		}
+
+		std::move(this->m_elements.begin(), this->m_elements.end(),
+				std::back_inserter(elements));
+
+		this->m_elements.clear();
+
+		lock.unlock();
+
+		this->m_notFull.notify_all();
+
+		return true;
+	}
+
+	/*!
+	 * @brief Ends the queue, wakes up all waiting threads.
+	 */
+	void close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->m_mutex);
+
+			this->m_closed = true;
+		}
+
+		this->m_notFull.notify_all();
+		this->m_notEmpty.notify_all();
+	}
+};
+
+#endif /* BOUNDEDQUEUE_H_ */
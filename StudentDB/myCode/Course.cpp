@@ -9,8 +9,7 @@
 
 #include "Course.h"
 
-#include "BlockCourse.h"
-#include "WeeklyCourse.h"
+#include "ModelFields.h"
 
 using namespace std;
 
@@ -61,6 +60,15 @@ const unsigned char Course::getmajor() const
 	return this->m_major;
 }
 
+const std::string& Course::getMajorName() const
+{
+	static const string unknownMajor;
+
+	map<unsigned char, string>::const_iterator itr = m_majorById.find(this->m_major);
+
+	return (itr != m_majorById.end()) ? itr->second : unknownMajor;
+}
+
 const float Course::getcreditPoints() const
 {
 	return this->m_creditPoints;
@@ -72,20 +80,7 @@ Course::~Course()
 
 void Course::write(std::ostream &out) const
 {
-	auto itr = this->m_majorById.find(this->m_major);
-
-	if(itr != this->m_majorById.end())
-	{
-		ostringstream oss;
-
-		oss << fixed << setprecision(1) << this->m_creditPoints;
-
-		string creditpoints = oss.str();
-
-		out << to_string(this->m_courseKey) << ";" << this->m_title << ";"
-				<< this->m_majorById.at(this->m_major) << ";" << creditpoints
-				<< ";" << this->getSemester();
-	}
+	writeFieldsText(out, *this, courseFields());
 }
 
 std::unique_ptr<Course> Course::read(std::istream &in)
@@ -213,77 +208,44 @@ Poco::JSON::Object::Ptr Course::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	returnObj->set("courseKey", this->m_courseKey);
-	returnObj->set("title", this->m_title);
-	returnObj->set("major", this->m_majorById.at(this->m_major));
-	returnObj->set("semester", getSemester());
-	returnObj->set("creditPoints", this->m_creditPoints);
+	writeFieldsJson(*returnObj, *this, courseFields());
 
 	return returnObj;
 }
 
-std::string Course::timetoString(const Poco::Data::Time time)
+std::unique_ptr<Course> Course::fromJson(Poco::JSON::Object::Ptr data)
 {
-	int hours = time.hour();
-	int minutes = time.minute();
+	string courseType = data->get("courseType").toString();
 
-	ostringstream oss;
-
-	oss << setw(2) << setfill('0') << hours << ":" << setw(2) << setfill('0') << minutes;
+	if(courseType == "B" || courseType == "b")
+	{
+		return BlockCourse::fromJson(data);
+	}
+	else if(courseType == "W" || courseType == "w")
+	{
+		return WeeklyCourse::fromJson(data);
+	}
 
-	return oss.str();
+	return nullptr;
 }
 
-std::string Course::datetoString(const Poco::Data::Date date)
+void Course::writeBinary(std::ostream &out) const
 {
-	int year = date.year();
-	int month = date.month();
-	int day = date.day();
-
-	ostringstream oss;
-
-	oss << setw(2) << setfill('0') << day << "." << setw(2) << setfill('0')
-			<< month << "." << year;
-
-	return oss.str();
+	writeFieldsBinary(out, *this, courseFields());
 }
 
-Poco::Data::Time Course::timeFromString(const std::string time)
+std::unique_ptr<Course> Course::readBinary(std::istream &in)
 {
-	regex timePattern(R"((\d{1,2})\:(\d{1,2}))");
+	char courseType = static_cast<char>(readLittleEndian<uint8_t>(in));
 
-	Poco::DateTime pocoTime;
-
-	int i = 0;
-
-	if(regex_match(time, timePattern))
+	if(courseType == 'B')
 	{
-		pocoTime = Poco::DateTimeParser::parse("%H:%M", time, i);
+		return BlockCourse::readBinary(in);
 	}
-
-	int hour = pocoTime.hour();
-	int minutes = pocoTime.minute();
-	int seconds = pocoTime.second();
-
-	return Poco::Data::Time(hour, minutes, seconds);
-}
-
-Poco::Data::Date Course::dateFromString(const std::string date)
-{
-	regex datePattern(R"((\d{1,2})\.(\d{1,2})\.(\d{4}))");
-
-	smatch match;
-
-	Poco::DateTime dateTime;
-
-	if(regex_match(date, match, datePattern))
+	else if(courseType == 'W')
 	{
-		int year = stoi(match[3].str());
-		int month = stoi(match[2].str());
-		int day = stoi(match[1].str());
-
-		dateTime.assign(year, month, day);
+		return WeeklyCourse::readBinary(in);
 	}
 
-	return Poco::Data::Date(dateTime.year(), dateTime.month(), dateTime.day());
+	return nullptr;
 }
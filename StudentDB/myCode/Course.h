@@ -144,6 +144,14 @@ public:
 	 */
 	const unsigned char getmajor() const;
 
+	/*!
+	 * @brief Getter method to obtain the name of the major of the course.
+	 *
+	 * @return The major as mapped by m_majorById, an empty
+	 * string if the major is unknown.
+	 */
+	const std::string& getMajorName() const;
+
 	/*!
 	 * @brief Getter method to obtain the credit points of the course.
 	 *
@@ -199,46 +207,38 @@ public:
 	 */
 	virtual Poco::JSON::Object::Ptr toJson() const;
 
-protected:
-    /**
-     * @brief Convert Poco::Data::Time to a string representation.
-     *
-     * This static function converts a Poco::Data::Time object to its string representation.
-     *
-     * @param time Poco::Data::Time object to convert.
-     * @return String representation of the time.
-     */
-    static std::string timetoString(const Poco::Data::Time time);
-
-    /**
-     * @brief Convert Poco::Data::Date to a string representation.
-     *
-     * This static function converts a Poco::Data::Date object to its string representation.
-     *
-     * @param date Poco::Data::Date object to convert.
-     * @return String representation of the date.
-     */
-    static std::string datetoString(const Poco::Data::Date date);
-
-    /**
-     * @brief Convert string to Poco::Data::Time.
-     *
-     * This static function converts a string to a Poco::Data::Time object.
-     *
-     * @param time String representation of the time.
-     * @return Poco::Data::Time object.
-     */
-    static Poco::Data::Time timeFromString(const std::string time);
-
-    /**
-     * @brief Convert string to Poco::Data::Date.
-     *
-     * This static function converts a string to a Poco::Data::Date object.
-     *
-     * @param date String representation of the date.
-     * @return Poco::Data::Date object.
-     */
-    static Poco::Data::Date dateFromString(const std::string date);
+	/*!
+	 * @brief Creates a Course from JSON data.
+	 *
+	 * Delegates to BlockCourse::fromJson or WeeklyCourse::fromJson
+	 * depending on the "courseType" member.
+	 *
+	 * @param data A pointer to the Poco::JSON::Object containing JSON data.
+	 * @return A unique pointer to the dynamically allocated Course object,
+	 * or nullptr if an unsupported course type is encountered.
+	 */
+	static std::unique_ptr<Course> fromJson(Poco::JSON::Object::Ptr data);
+
+	/*!
+	 * @brief Write the object's data in the binary format.
+	 *
+	 * Derived classes write a type tag in front of their data,
+	 * so the course can be read back by readBinary().
+	 *
+	 * @param out The output stream where the object's data will be written.
+	 */
+	virtual void writeBinary(std::ostream& out) const;
+
+	/*!
+	 * @brief Reads a Course written by writeBinary() of a derived class.
+	 *
+	 * @param in The input stream from which to read the Course.
+	 * @return A unique pointer to the dynamically allocated Course object,
+	 * or nullptr if an unsupported course type is encountered.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static std::unique_ptr<Course> readBinary(std::istream& in);
+
 };
 
 #endif /* COURSE_H_ */
@@ -0,0 +1,114 @@
+/*!
+ * @file CourseStatistics.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "CourseStatistics.h"
+
+#include <algorithm>
+
+using namespace std;
+
+CourseStatistics::CourseStatistics() :
+		m_noOfEnrollments(0), m_noOfGraded(0), m_gradeSum(0), m_gradeSquareSum(0)
+{
+	this->m_buckets.fill(0);
+}
+
+void CourseStatistics::accountGrade(float grade, int sign)
+{
+	if(grade == 0)
+	{
+		return;
+	}
+
+	this->m_noOfGraded += sign;
+	this->m_gradeSum += sign * static_cast<double>(grade);
+	this->m_gradeSquareSum += sign * static_cast<double>(grade) * grade;
+	this->m_buckets[bucketOf(grade)] += sign;
+
+	//! Guards against rounding leftovers once the last grade is gone.
+	if(this->m_noOfGraded == 0)
+	{
+		this->m_gradeSum = 0;
+		this->m_gradeSquareSum = 0;
+	}
+}
+
+void CourseStatistics::addEnrollment(float grade)
+{
+	this->m_noOfEnrollments++;
+
+	this->accountGrade(grade, 1);
+}
+
+void CourseStatistics::removeEnrollment(float grade)
+{
+	this->m_noOfEnrollments--;
+
+	this->accountGrade(grade, -1);
+}
+
+unsigned int CourseStatistics::getNoOfEnrollments() const
+{
+	return this->m_noOfEnrollments;
+}
+
+unsigned int CourseStatistics::getNoOfGraded() const
+{
+	return this->m_noOfGraded;
+}
+
+double CourseStatistics::getGradeSum() const
+{
+	return this->m_gradeSum;
+}
+
+double CourseStatistics::getGradeSquareSum() const
+{
+	return this->m_gradeSquareSum;
+}
+
+unsigned int CourseStatistics::getBucket(unsigned int bucketIdx) const
+{
+	return this->m_buckets.at(bucketIdx);
+}
+
+double CourseStatistics::getMeanGrade() const
+{
+	if(this->m_noOfGraded == 0)
+	{
+		return 0;
+	}
+
+	return this->m_gradeSum / this->m_noOfGraded;
+}
+
+double CourseStatistics::getGradeVariance() const
+{
+	if(this->m_noOfGraded == 0)
+	{
+		return 0;
+	}
+
+	double mean = this->getMeanGrade();
+
+	//! May drop slightly below 0 by rounding when all grades are equal.
+	return max(this->m_gradeSquareSum / this->m_noOfGraded - mean * mean, 0.0);
+}
+
+unsigned int CourseStatistics::bucketOf(float grade)
+{
+	int bucketIdx = static_cast<int>((grade - 1.0f) * 2);
+
+	return min<int>(max(bucketIdx, 0), noOfBuckets - 1);
+}
+
+float CourseStatistics::bucketLowerBound(unsigned int bucketIdx)
+{
+	return 1.0f + bucketIdx * 0.5f;
+}
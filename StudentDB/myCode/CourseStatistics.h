@@ -0,0 +1,112 @@
+/*!
+ * @file CourseStatistics.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef COURSESTATISTICS_H_
+#define COURSESTATISTICS_H_
+
+#include <array>
+
+/*!
+ * @class CourseStatistics
+ * @brief Enrollment and grade aggregates of one course.
+ *
+ * The aggregates are updated with every enrollment added, removed or
+ * graded, so the count, mean, variance and distribution of the grades
+ * are read without visiting the students. A grade of 0 means that the
+ * enrollment is not graded yet, it is counted as enrollment only.
+ *
+ * The grades are counted in buckets of half a grade, bucket i holds the
+ * grades from 1.0 + i * 0.5 up to 1.5 + i * 0.5. Better grades are counted
+ * in the first bucket, worse ones in the last.
+ */
+class CourseStatistics
+{
+public:
+	/*!
+	 * @brief Number of buckets, the last one also holds 5.0 and worse.
+	 */
+	static const unsigned int noOfBuckets = 8;
+
+private:
+	/*!
+	 * @var m_noOfEnrollments - Number of enrollments, graded or not.
+	 */
+	unsigned int m_noOfEnrollments;
+
+	/*!
+	 * @var m_noOfGraded - Number of graded enrollments.
+	 */
+	unsigned int m_noOfGraded;
+
+	/*!
+	 * @var m_gradeSum, m_gradeSquareSum - Sum of the grades and of
+	 * their squares.
+	 */
+	double m_gradeSum;
+	double m_gradeSquareSum;
+
+	/*!
+	 * @var m_buckets - Number of grades per bucket.
+	 */
+	std::array<unsigned int, noOfBuckets> m_buckets;
+
+	/*!
+	 * @brief Adds a grade to the sums and the histogram, or removes it
+	 * if sign is -1.
+	 */
+	void accountGrade(float grade, int sign);
+
+public:
+	/*!
+	 * @brief Constructor of the statistics of a course without enrollments.
+	 */
+	CourseStatistics();
+
+	/*!
+	 * @brief Counts an enrollment with its grade.
+	 */
+	void addEnrollment(float grade);
+
+	/*!
+	 * @brief Removes an enrollment counted with addEnrollment().
+	 */
+	void removeEnrollment(float grade);
+
+	/*!
+	 * @brief Getter methods for the aggregates.
+	 */
+	unsigned int getNoOfEnrollments() const;
+	unsigned int getNoOfGraded() const;
+	double getGradeSum() const;
+	double getGradeSquareSum() const;
+	unsigned int getBucket(unsigned int bucketIdx) const;
+
+	/*!
+	 * @brief Returns the mean of the grades, 0 if nothing is graded.
+	 */
+	double getMeanGrade() const;
+
+	/*!
+	 * @brief Returns the population variance of the grades, 0 if
+	 * nothing is graded.
+	 */
+	double getGradeVariance() const;
+
+	/*!
+	 * @brief Returns the bucket of a grade.
+	 */
+	static unsigned int bucketOf(float grade);
+
+	/*!
+	 * @brief Returns the best grade of a bucket.
+	 */
+	static float bucketLowerBound(unsigned int bucketIdx);
+};
+
+#endif /* COURSESTATISTICS_H_ */
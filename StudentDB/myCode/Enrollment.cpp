@@ -9,6 +9,8 @@
 
 #include "Enrollment.h"
 
+#include "ModelFields.h"
+
 using namespace std;
 
 Enrollment::Enrollment(std::string semester, const Course* courseObj) :
@@ -20,6 +22,23 @@ Enrollment::~Enrollment()
 {
 }
 
+/*!
+ * @brief Builds an Enrollment from decoded field values, resolving the
+ * course key in courses. The course is nullptr if the key is unknown.
+ */
+template<typename Values>
+static Enrollment makeEnrollment(const Values& values,
+		const std::map<int, std::unique_ptr<const Course>>& courses)
+{
+	map<int, unique_ptr<const Course>>::const_iterator itr = courses.find(get<0>(values));
+
+	Enrollment enrollment(get<1>(values), (itr != courses.end()) ? itr->second.get() : nullptr);
+
+	enrollment.setgrade(get<2>(values));
+
+	return enrollment;
+}
+
 const float Enrollment::getgrade() const
 {
 	return this->m_grade;
@@ -42,12 +61,7 @@ void Enrollment::setgrade(const float &grade)
 
 void Enrollment::write(std::ostream &out) const
 {
-	ostringstream oss;
-
-	oss << fixed << setprecision(1) << this->m_grade;
-
-	out << to_string(this->m_course->getcourseKey())
-					<< ";" << this->m_semester << ";" << oss.str();
+	writeFieldsText(out, *this, enrollmentFields());
 }
 
 Enrollment Enrollment::read(std::istream &in, const Course *courseobj)
@@ -56,31 +70,58 @@ Enrollment Enrollment::read(std::istream &in, const Course *courseobj)
 
 	getline(in, inStr);
 
-	unsigned int courseKey = stoul(splitAt(inStr, ';'));
-	string semester = splitAt(inStr, ';');
-	float grade = stof(splitAt(inStr, ';'));
+	auto values = readFieldsText(inStr, enrollmentFields());
 
-	if(courseobj->getcourseKey() == courseKey)
+	if(courseobj->getcourseKey() == get<0>(values))
 	{
-		Enrollment readEnrollment(semester, courseobj);
+		Enrollment readEnrollment(get<1>(values), courseobj);
 
-		readEnrollment.setgrade(grade);
+		readEnrollment.setgrade(get<2>(values));
 
 		return readEnrollment;
 	}
 	else
 	{
-		return Enrollment(semester, nullptr);
+		return Enrollment(get<1>(values), nullptr);
 	}
 }
 
+Enrollment Enrollment::read(std::istream &in,
+		const std::map<int, std::unique_ptr<const Course>>& courses)
+{
+	string inStr;
+
+	getline(in, inStr);
+
+	return makeEnrollment(readFieldsText(inStr, enrollmentFields()), courses);
+}
+
 Poco::JSON::Object::Ptr Enrollment::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	returnObj->set("semester", this->m_semester);
-	returnObj->set("courseKey", getcourse()->getcourseKey());
-	returnObj->set("grade", this->m_grade);
+	writeFieldsJson(*returnObj, *this, enrollmentFields());
 
 	return returnObj;
 }
+
+Enrollment Enrollment::fromJson(Poco::JSON::Object::Ptr data,
+		const std::map<int, std::unique_ptr<const Course>>& courses)
+{
+	auto values = readFieldsJson(*data, enrollmentFields());
+
+	return makeEnrollment(values, courses);
+}
+
+void Enrollment::writeBinary(std::ostream &out) const
+{
+	writeFieldsBinary(out, *this, enrollmentFields());
+}
+
+Enrollment Enrollment::readBinary(std::istream &in,
+		const std::map<int, std::unique_ptr<const Course>>& courses)
+{
+	auto values = readFieldsBinary(in, enrollmentFields());
+
+	return makeEnrollment(values, courses);
+}
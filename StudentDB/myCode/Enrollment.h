@@ -12,6 +12,9 @@
 
 #include "Course.h"
 
+#include <map>
+#include <memory>
+
 /*!
  * @class Enrollment
  * @brief Represents the enrollment of a student in a
@@ -106,6 +109,18 @@ public:
 	 */
 	static Enrollment read(std::istream& in, const Course* courseobj);
 
+	/*!
+	 * @brief Reads an Enrollment in the format of read(), the course key
+	 * is looked up once.
+	 *
+	 * @param in The input stream from which the Enrollment will be read.
+	 * @param courses The courses, used to resolve the course key.
+	 * @return The constructed Enrollment, its course is nullptr
+	 * if the course key is not in courses.
+	 */
+	static Enrollment read(std::istream& in,
+			const std::map<int, std::unique_ptr<const Course>>& courses);
+
 	/**
 	 * @brief Convert the enrollment object to a Poco::JSON::Object::Ptr.
 	 *
@@ -115,6 +130,37 @@ public:
 	 * @return Poco::JSON::Object::Ptr representing the enrollment in JSON.
 	 */
 	Poco::JSON::Object::Ptr toJson() const;
+
+	/*!
+	 * @brief Creates an Enrollment from JSON data.
+	 *
+	 * @param data A pointer to the Poco::JSON::Object containing JSON data.
+	 * @param courses The courses, used to resolve the course key.
+	 * @return The constructed Enrollment, its course is nullptr
+	 * if the course key is not in courses.
+	 * @throws Poco::NotFoundException if a member is missing.
+	 */
+	static Enrollment fromJson(Poco::JSON::Object::Ptr data,
+			const std::map<int, std::unique_ptr<const Course>>& courses);
+
+	/*!
+	 * @brief Writes the Enrollment in the binary format.
+	 *
+	 * @param out The output stream to which the Enrollment will be written.
+	 */
+	void writeBinary(std::ostream& out) const;
+
+	/*!
+	 * @brief Reads an Enrollment written by writeBinary().
+	 *
+	 * @param in The input stream from which the Enrollment will be read.
+	 * @param courses The courses, used to resolve the course key.
+	 * @return The constructed Enrollment, its course is nullptr
+	 * if the course key is not in courses.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static Enrollment readBinary(std::istream& in,
+			const std::map<int, std::unique_ptr<const Course>>& courses);
 };
 
 #endif /* ENROLLMENT_H_ */
@@ -0,0 +1,581 @@
+/*!
+ * @file FieldDescriptors.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef FIELDDESCRIPTORS_H_
+#define FIELDDESCRIPTORS_H_
+
+#include <tuple>
+#include <utility>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+#include <Poco/Exception.h>
+
+#include "JsonFieldReader.h"
+
+/*!
+ * @struct FieldDescriptor
+ * @brief Compile-time description of one serialized field of a model class.
+ *
+ * The getter is a stateless lambda, so its type identifies the accessor and
+ * every serializer loop over a tuple of descriptors is resolved and inlined
+ * at compile time. Value selects the FieldCodec used for all formats.
+ */
+template<typename Value, typename Getter>
+struct FieldDescriptor
+{
+	typedef Value value_type;	///< The type the field is serialized as.
+
+	const char* name;			///< The JSON key of the field.
+	Getter get;					///< Reads the field from the model object.
+};
+
+/*!
+ * @brief Creates a FieldDescriptor, Value is given explicitly.
+ *
+ * @param name The JSON key of the field.
+ * @param get Stateless lambda reading the field from the model object.
+ * @return The field descriptor.
+ */
+template<typename Value, typename Getter>
+inline FieldDescriptor<Value, Getter> makeField(const char* name, Getter get)
+{
+	return FieldDescriptor<Value, Getter>{name, get};
+}
+
+/*!
+ * @brief The tuple of values described by a tuple of field descriptors.
+ */
+template<typename FieldsTuple>
+struct FieldValuesOf;
+
+template<typename... Fields>
+struct FieldValuesOf<std::tuple<Fields...>>
+{
+	typedef std::tuple<typename Fields::value_type...> type;
+};
+
+template<typename Tuple, typename Func, std::size_t... Index>
+inline void forEachFieldImpl(const Tuple& fields, Func& func, std::index_sequence<Index...>)
+{
+	using expander = int[];
+	(void)expander{0, (func(std::get<Index>(fields),
+			std::integral_constant<std::size_t, Index>()), 0)...};
+}
+
+/*!
+ * @brief Calls func(field, index) for every field descriptor, unrolled
+ * at compile time. index is a std::integral_constant.
+ */
+template<typename... Fields, typename Func>
+inline void forEachField(const std::tuple<Fields...>& fields, Func func)
+{
+	forEachFieldImpl(fields, func, std::index_sequence_for<Fields...>());
+}
+
+template<typename Func, typename Values, std::size_t... Index>
+inline auto applyValuesImpl(Func& func, Values& values, std::index_sequence<Index...>)
+-> decltype(func(std::move(std::get<Index>(values))...))
+{
+	return func(std::move(std::get<Index>(values))...);
+}
+
+/*!
+ * @brief Calls func with the elements of the values tuple as arguments,
+ * used to pass decoded fields to a constructor.
+ */
+template<typename Func, typename... Values>
+inline auto applyValues(Func func, std::tuple<Values...>& values)
+-> decltype(applyValuesImpl(func, values, std::index_sequence_for<Values...>()))
+{
+	return applyValuesImpl(func, values, std::index_sequence_for<Values...>());
+}
+
+/*!
+ * @brief Writes an integer as little endian bytes.
+ */
+template<typename Integer>
+inline void writeLittleEndian(std::ostream& out, Integer value)
+{
+	char bytes[sizeof(Integer)];
+
+	for(std::size_t idx = 0; idx < sizeof(Integer); idx++)
+	{
+		bytes[idx] = static_cast<char>((static_cast<std::uint64_t>(value) >> (8 * idx)) & 0xFF);
+	}
+
+	out.write(bytes, sizeof(Integer));
+}
+
+/*!
+ * @brief Reads an integer from little endian bytes.
+ *
+ * @throws Poco::DataException if the input ends early.
+ */
+template<typename Integer>
+inline Integer readLittleEndian(std::istream& in)
+{
+	unsigned char bytes[sizeof(Integer)];
+
+	if(!in.read(reinterpret_cast<char*>(bytes), sizeof(Integer)))
+	{
+		throw Poco::DataException("Unexpected end of binary data");
+	}
+
+	std::uint64_t value = 0;
+
+	for(std::size_t idx = 0; idx < sizeof(Integer); idx++)
+	{
+		value |= static_cast<std::uint64_t>(bytes[idx]) << (8 * idx);
+	}
+
+	return static_cast<Integer>(value);
+}
+
+/*!
+ * @struct FieldCodec
+ * @brief Text, JSON and binary encoding of one field value type.
+ *
+ * The text encoding is the one of the semicolon separated file format,
+ * the JSON encoding the one of the toJson() output.
+ */
+template<typename Value>
+struct FieldCodec;
+
+template<>
+struct FieldCodec<unsigned int>
+{
+	static void writeText(std::ostream& out, unsigned int value)
+	{
+		out << value;
+	}
+	static void readText(const std::string& text, unsigned int& value)
+	{
+		value = std::stoul(text);
+	}
+	static Poco::Dynamic::Var toJson(unsigned int value)
+	{
+		return value;
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, unsigned int& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, unsigned int value)
+	{
+		writeLittleEndian<std::uint32_t>(out, value);
+	}
+	static void readBinary(std::istream& in, unsigned int& value)
+	{
+		value = readLittleEndian<std::uint32_t>(in);
+	}
+};
+
+template<>
+struct FieldCodec<unsigned short>
+{
+	static void writeText(std::ostream& out, unsigned short value)
+	{
+		out << value;
+	}
+	static void readText(const std::string& text, unsigned short& value)
+	{
+		value = static_cast<unsigned short>(std::stoi(text));
+	}
+	static Poco::Dynamic::Var toJson(unsigned short value)
+	{
+		return value;
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, unsigned short& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, unsigned short value)
+	{
+		writeLittleEndian<std::uint16_t>(out, value);
+	}
+	static void readBinary(std::istream& in, unsigned short& value)
+	{
+		value = readLittleEndian<std::uint16_t>(in);
+	}
+};
+
+template<>
+struct FieldCodec<std::string>
+{
+	static void writeText(std::ostream& out, const std::string& value)
+	{
+		out << value;
+	}
+	static void readText(const std::string& text, std::string& value)
+	{
+		value = text;
+	}
+	static Poco::Dynamic::Var toJson(const std::string& value)
+	{
+		return value;
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, std::string& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, const std::string& value)
+	{
+		writeLittleEndian<std::uint32_t>(out, static_cast<std::uint32_t>(value.size()));
+		out.write(value.data(), value.size());
+	}
+	static void readBinary(std::istream& in, std::string& value)
+	{
+		value.resize(readLittleEndian<std::uint32_t>(in));
+
+		if(!value.empty() && !in.read(&value[0], value.size()))
+		{
+			throw Poco::DataException("Unexpected end of binary data");
+		}
+	}
+};
+
+/*!
+ * Credit points and grades, written with one decimal in the text format.
+ */
+template<>
+struct FieldCodec<float>
+{
+	static void writeText(std::ostream& out, float value)
+	{
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.1f", value);
+		out << buffer;
+	}
+	static void readText(const std::string& text, float& value)
+	{
+		value = std::stof(text);
+	}
+	static Poco::Dynamic::Var toJson(float value)
+	{
+		return value;
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, float& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, float value)
+	{
+		std::uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		writeLittleEndian<std::uint32_t>(out, bits);
+	}
+	static void readBinary(std::istream& in, float& value)
+	{
+		std::uint32_t bits = readLittleEndian<std::uint32_t>(in);
+		std::memcpy(&value, &bits, sizeof(value));
+	}
+};
+
+/*!
+ * Dates, written as "dd.mm.YYYY" in the text and JSON formats.
+ */
+template<>
+struct FieldCodec<Poco::Data::Date>
+{
+	static void writeText(std::ostream& out, const Poco::Data::Date& value)
+	{
+		char buffer[16];
+		std::snprintf(buffer, sizeof(buffer), "%02d.%02d.%d",
+				value.day(), value.month(), value.year());
+		out << buffer;
+	}
+	static void readText(const std::string& text, Poco::Data::Date& value)
+	{
+		value = stringToPocoDateFormatter(text);
+	}
+	static Poco::Dynamic::Var toJson(const Poco::Data::Date& value)
+	{
+		char buffer[16];
+		std::snprintf(buffer, sizeof(buffer), "%02d.%02d.%d",
+				value.day(), value.month(), value.year());
+		return std::string(buffer);
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, Poco::Data::Date& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, const Poco::Data::Date& value)
+	{
+		writeLittleEndian<std::uint16_t>(out, static_cast<std::uint16_t>(value.year()));
+		writeLittleEndian<std::uint8_t>(out, static_cast<std::uint8_t>(value.month()));
+		writeLittleEndian<std::uint8_t>(out, static_cast<std::uint8_t>(value.day()));
+	}
+	static void readBinary(std::istream& in, Poco::Data::Date& value)
+	{
+		int year = readLittleEndian<std::uint16_t>(in);
+		int month = readLittleEndian<std::uint8_t>(in);
+		int day = readLittleEndian<std::uint8_t>(in);
+		value = Poco::Data::Date(year, month, day);
+	}
+};
+
+/*!
+ * Times, written as "HH:MM" in the text and JSON formats.
+ */
+template<>
+struct FieldCodec<Poco::Data::Time>
+{
+	static void writeText(std::ostream& out, const Poco::Data::Time& value)
+	{
+		char buffer[8];
+		std::snprintf(buffer, sizeof(buffer), "%02d:%02d", value.hour(), value.minute());
+		out << buffer;
+	}
+	static void readText(const std::string& text, Poco::Data::Time& value)
+	{
+		value = stringToPocoTimeFormatter(text);
+	}
+	static Poco::Dynamic::Var toJson(const Poco::Data::Time& value)
+	{
+		char buffer[8];
+		std::snprintf(buffer, sizeof(buffer), "%02d:%02d", value.hour(), value.minute());
+		return std::string(buffer);
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, Poco::Data::Time& value)
+	{
+		readJsonValue(json, value);
+	}
+	static void writeBinary(std::ostream& out, const Poco::Data::Time& value)
+	{
+		writeLittleEndian<std::uint8_t>(out, static_cast<std::uint8_t>(value.hour()));
+		writeLittleEndian<std::uint8_t>(out, static_cast<std::uint8_t>(value.minute()));
+	}
+	static void readBinary(std::istream& in, Poco::Data::Time& value)
+	{
+		int hour = readLittleEndian<std::uint8_t>(in);
+		int minute = readLittleEndian<std::uint8_t>(in);
+		value = Poco::Data::Time(hour, minute, 0);
+	}
+};
+
+/*!
+ * Week days, written as number (Sunday - 0, Saturday - 6).
+ */
+template<>
+struct FieldCodec<Poco::DateTime::DaysOfWeek>
+{
+	static void writeText(std::ostream& out, Poco::DateTime::DaysOfWeek value)
+	{
+		out << static_cast<int>(value);
+	}
+	static void readText(const std::string& text, Poco::DateTime::DaysOfWeek& value)
+	{
+		if(text.size() == 1 && text[0] >= '0' && text[0] <= '6')
+		{
+			value = static_cast<Poco::DateTime::DaysOfWeek>(text[0] - '0');
+		}
+		else
+		{
+			value = getDayOfWeekFromString(text);
+		}
+	}
+	static Poco::Dynamic::Var toJson(Poco::DateTime::DaysOfWeek value)
+	{
+		return static_cast<int>(value);
+	}
+	static void fromJson(const Poco::Dynamic::Var& json, Poco::DateTime::DaysOfWeek& value)
+	{
+		int day = 0;
+		readJsonValue(json, day);
+		value = static_cast<Poco::DateTime::DaysOfWeek>(day);
+	}
+	static void writeBinary(std::ostream& out, Poco::DateTime::DaysOfWeek value)
+	{
+		writeLittleEndian<std::uint8_t>(out, static_cast<std::uint8_t>(value));
+	}
+	static void readBinary(std::istream& in, Poco::DateTime::DaysOfWeek& value)
+	{
+		value = static_cast<Poco::DateTime::DaysOfWeek>(readLittleEndian<std::uint8_t>(in));
+	}
+};
+
+/*!
+ * @brief The FieldCodec of a field descriptor.
+ */
+template<typename Field>
+using CodecOf = FieldCodec<typename std::decay_t<Field>::value_type>;
+
+/*!
+ * @brief Writes the fields of owner in the semicolon separated text format.
+ */
+template<typename Owner, typename FieldsTuple>
+inline void writeFieldsText(std::ostream& out, const Owner& owner, const FieldsTuple& fields)
+{
+	forEachField(fields, [&out, &owner](const auto& field, auto index)
+	{
+		if(decltype(index)::value > 0)
+		{
+			out << ';';
+		}
+
+		CodecOf<decltype(field)>::writeText(out, field.get(owner));
+	});
+}
+
+/*!
+ * @brief Reads the fields from the front of a semicolon separated line.
+ *
+ * @param remainder The line, modified to contain the part after the fields.
+ * @param fields The field descriptors.
+ * @return The decoded values in the order of the descriptors.
+ */
+template<typename FieldsTuple>
+inline typename FieldValuesOf<FieldsTuple>::type
+readFieldsText(std::string& remainder, const FieldsTuple& fields)
+{
+	typename FieldValuesOf<FieldsTuple>::type values;
+
+	forEachField(fields, [&remainder, &values](const auto& field, auto index)
+	{
+		CodecOf<decltype(field)>::readText(splitAt(remainder, ';'),
+				std::get<decltype(index)::value>(values));
+	});
+
+	return values;
+}
+
+/*!
+ * @brief Sets the fields of owner as members of a JSON object.
+ */
+template<typename Owner, typename FieldsTuple>
+inline void writeFieldsJson(Poco::JSON::Object& object, const Owner& owner,
+		const FieldsTuple& fields)
+{
+	forEachField(fields, [&object, &owner](const auto& field, auto)
+	{
+		object.set(field.name, CodecOf<decltype(field)>::toJson(field.get(owner)));
+	});
+}
+
+/*!
+ * @brief The mask with one bit for every descriptor, the bit of the
+ * first descriptor is the lowest.
+ */
+template<typename FieldsTuple>
+inline std::uint32_t allFieldsMask(const FieldsTuple&)
+{
+	static_assert(std::tuple_size<FieldsTuple>::value < 32, "Too many fields for the mask");
+
+	return (std::uint32_t(1) << std::tuple_size<FieldsTuple>::value) - 1;
+}
+
+/*!
+ * @brief Converts one JSON member into the value of the descriptor
+ * with the member's name, used by the streaming JSON import.
+ *
+ * @param name The name of the member.
+ * @param json The value of the member.
+ * @param fields The field descriptors.
+ * @param values The values in the order of the descriptors.
+ * @param fieldsRead Receives the bit of the descriptor, see allFieldsMask().
+ * @return False if no descriptor has the name, values is unchanged then.
+ */
+template<typename FieldsTuple>
+inline bool readFieldJson(const std::string& name, const Poco::Dynamic::Var& json,
+		const FieldsTuple& fields, typename FieldValuesOf<FieldsTuple>::type& values,
+		std::uint32_t& fieldsRead)
+{
+	bool isField = false;
+
+	forEachField(fields, [&name, &json, &values, &fieldsRead, &isField](const auto& field, auto index)
+	{
+		if(name == field.name)
+		{
+			CodecOf<decltype(field)>::fromJson(json, std::get<decltype(index)::value>(values));
+			fieldsRead |= std::uint32_t(1) << decltype(index)::value;
+			isField = true;
+		}
+	});
+
+	return isField;
+}
+
+/*!
+ * @brief Checks that every descriptor was read.
+ *
+ * @param fieldsRead The bits collected by readFieldJson().
+ * @throws Poco::NotFoundException if a field is missing.
+ */
+template<typename FieldsTuple>
+inline void checkFieldsRead(std::uint32_t fieldsRead, const FieldsTuple& fields)
+{
+	if(fieldsRead != allFieldsMask(fields))
+	{
+		throw Poco::NotFoundException("Incomplete JSON data");
+	}
+}
+
+/*!
+ * @brief Reads the fields from a parsed JSON object.
+ *
+ * Walks the members of the object once and converts every member
+ * that matches a descriptor in place. Other members are ignored.
+ *
+ * @return The decoded values in the order of the descriptors.
+ * @throws Poco::NotFoundException if a field is missing.
+ */
+template<typename FieldsTuple>
+inline typename FieldValuesOf<FieldsTuple>::type
+readFieldsJson(const Poco::JSON::Object& object, const FieldsTuple& fields)
+{
+	typename FieldValuesOf<FieldsTuple>::type values;
+
+	std::uint32_t fieldsRead = 0;
+
+	for(const Poco::JSON::Object::ValueType& member : object)
+	{
+		readFieldJson(member.first, member.second, fields, values, fieldsRead);
+	}
+
+	checkFieldsRead(fieldsRead, fields);
+
+	return values;
+}
+
+/*!
+ * @brief Writes the fields of owner in the binary format.
+ */
+template<typename Owner, typename FieldsTuple>
+inline void writeFieldsBinary(std::ostream& out, const Owner& owner, const FieldsTuple& fields)
+{
+	forEachField(fields, [&out, &owner](const auto& field, auto)
+	{
+		CodecOf<decltype(field)>::writeBinary(out, field.get(owner));
+	});
+}
+
+/*!
+ * @brief Reads the fields in the binary format.
+ *
+ * @return The decoded values in the order of the descriptors.
+ * @throws Poco::DataException if the input ends early.
+ */
+template<typename FieldsTuple>
+inline typename FieldValuesOf<FieldsTuple>::type
+readFieldsBinary(std::istream& in, const FieldsTuple& fields)
+{
+	typename FieldValuesOf<FieldsTuple>::type values;
+
+	forEachField(fields, [&in, &values](const auto& field, auto index)
+	{
+		CodecOf<decltype(field)>::readBinary(in, std::get<decltype(index)::value>(values));
+	});
+
+	return values;
+}
+
+#endif /* FIELDDESCRIPTORS_H_ */
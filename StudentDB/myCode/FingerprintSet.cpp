@@ -0,0 +1,169 @@
+/*!
+ * @file FingerprintSet.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "FingerprintSet.h"
+
+using namespace std;
+
+FingerprintSet::FingerprintSet() : m_size(0)
+{
+}
+
+std::uint64_t FingerprintSet::slotValue(std::uint64_t fingerprint)
+{
+	return (fingerprint == 0) ? 1 : fingerprint;
+}
+
+std::size_t FingerprintSet::findSlot(std::uint64_t value) const
+{
+	size_t mask = this->m_slots.size() - 1;
+
+	size_t slotIdx = value & mask;
+
+	while(this->m_slots[slotIdx] != 0 && this->m_slots[slotIdx] != value)
+	{
+		slotIdx = (slotIdx + 1) & mask;
+	}
+
+	return slotIdx;
+}
+
+void FingerprintSet::rehash(std::size_t minSlots)
+{
+	size_t noOfSlots = 16;
+
+	while(noOfSlots < minSlots)
+	{
+		noOfSlots *= 2;
+	}
+
+	vector<uint64_t> slots(noOfSlots, 0);
+	vector<unsigned int> counts(noOfSlots, 0);
+
+	this->m_slots.swap(slots);
+	this->m_counts.swap(counts);
+
+	for(size_t slotIdx = 0; slotIdx < slots.size(); slotIdx++)
+	{
+		if(slots[slotIdx] != 0)
+		{
+			size_t newIdx = this->findSlot(slots[slotIdx]);
+
+			this->m_slots[newIdx] = slots[slotIdx];
+			this->m_counts[newIdx] = counts[slotIdx];
+		}
+	}
+}
+
+bool FingerprintSet::insert(std::uint64_t fingerprint)
+{
+	//! At most three quarters of the slots are used.
+	if((this->m_size + 1) * 4 > this->m_slots.size() * 3)
+	{
+		this->rehash(this->m_slots.size() * 2);
+	}
+
+	uint64_t value = slotValue(fingerprint);
+
+	size_t slotIdx = this->findSlot(value);
+
+	this->m_counts[slotIdx]++;
+
+	if(this->m_slots[slotIdx] == value)
+	{
+		return false;
+	}
+
+	this->m_slots[slotIdx] = value;
+	this->m_size++;
+
+	return true;
+}
+
+bool FingerprintSet::contains(std::uint64_t fingerprint) const
+{
+	if(this->m_size == 0)
+	{
+		return false;
+	}
+
+	uint64_t value = slotValue(fingerprint);
+
+	return this->m_slots[this->findSlot(value)] == value;
+}
+
+void FingerprintSet::erase(std::uint64_t fingerprint)
+{
+	if(this->m_size == 0)
+	{
+		return;
+	}
+
+	uint64_t value = slotValue(fingerprint);
+
+	size_t holeIdx = this->findSlot(value);
+
+	if(this->m_slots[holeIdx] != value || --this->m_counts[holeIdx] > 0)
+	{
+		return;
+	}
+
+	this->m_slots[holeIdx] = 0;
+	this->m_size--;
+
+	//! Shift the following entries back, so no probe sequence is broken.
+	size_t mask = this->m_slots.size() - 1;
+
+	size_t slotIdx = holeIdx;
+
+	while(true)
+	{
+		slotIdx = (slotIdx + 1) & mask;
+
+		if(this->m_slots[slotIdx] == 0)
+		{
+			break;
+		}
+
+		size_t homeIdx = this->m_slots[slotIdx] & mask;
+
+		bool homeBetween = (holeIdx <= slotIdx) ? (holeIdx < homeIdx && homeIdx <= slotIdx)
+				: (holeIdx < homeIdx || homeIdx <= slotIdx);
+
+		if(!homeBetween)
+		{
+			this->m_slots[holeIdx] = this->m_slots[slotIdx];
+			this->m_counts[holeIdx] = this->m_counts[slotIdx];
+			this->m_slots[slotIdx] = 0;
+			this->m_counts[slotIdx] = 0;
+
+			holeIdx = slotIdx;
+		}
+	}
+}
+
+void FingerprintSet::clear()
+{
+	this->m_slots.clear();
+	this->m_counts.clear();
+	this->m_size = 0;
+}
+
+void FingerprintSet::reserve(std::size_t noOfFingerprints)
+{
+	if(noOfFingerprints * 4 > this->m_slots.size() * 3)
+	{
+		this->rehash(noOfFingerprints * 4 / 3 + 1);
+	}
+}
+
+std::size_t FingerprintSet::size() const
+{
+	return this->m_size;
+}
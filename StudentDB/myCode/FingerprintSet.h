@@ -0,0 +1,104 @@
+/*!
+ * @file FingerprintSet.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef FINGERPRINTSET_H_
+#define FINGERPRINTSET_H_
+
+#include <cstdint>
+#include <vector>
+
+/*!
+ * @class FingerprintSet
+ * @brief A compact hash set of 64 bit fingerprints.
+ *
+ * The fingerprints are kept in one array with open addressing and linear
+ * probing, 12 bytes per slot and no allocation per element. Every
+ * fingerprint has a count, so an erase only removes it once all its
+ * insertions have been erased. The fingerprints are expected to be
+ * hash values already, their low bits select the slot. The fingerprints
+ * 0 and 1 share a slot value, so they count as the same fingerprint.
+ */
+class FingerprintSet
+{
+private:
+	/*!
+	 * @var m_slots - The fingerprints, 0 marks an empty slot.
+	 */
+	std::vector<std::uint64_t> m_slots;
+
+	/*!
+	 * @var m_counts - The number of insertions of the fingerprint in each slot.
+	 */
+	std::vector<unsigned int> m_counts;
+
+	/*!
+	 * @var m_size - Number of different fingerprints in the set.
+	 */
+	std::size_t m_size;
+
+	/*!
+	 * @brief Maps a fingerprint to the value stored in its slot,
+	 * 0 is reserved for empty slots.
+	 */
+	static std::uint64_t slotValue(std::uint64_t fingerprint);
+
+	/*!
+	 * @brief Returns the slot holding the value or the empty slot
+	 * that ends its probe sequence.
+	 */
+	std::size_t findSlot(std::uint64_t value) const;
+
+	/*!
+	 * @brief Rehashes into an array with at least the given number of slots.
+	 */
+	void rehash(std::size_t minSlots);
+
+public:
+	/*!
+	 * @brief Constructor of an empty set.
+	 */
+	FingerprintSet();
+
+	/*!
+	 * @brief Inserts a fingerprint or counts one more insertion of it.
+	 *
+	 * @return True if the fingerprint was not in the set before.
+	 */
+	bool insert(std::uint64_t fingerprint);
+
+	/*!
+	 * @brief Checks for a fingerprint.
+	 *
+	 * @return True if the fingerprint is in the set.
+	 */
+	bool contains(std::uint64_t fingerprint) const;
+
+	/*!
+	 * @brief Erases one insertion of a fingerprint, the fingerprint is
+	 * removed with its last insertion.
+	 */
+	void erase(std::uint64_t fingerprint);
+
+	/*!
+	 * @brief Removes all fingerprints.
+	 */
+	void clear();
+
+	/*!
+	 * @brief Prepares the set for the given number of fingerprints.
+	 */
+	void reserve(std::size_t noOfFingerprints);
+
+	/*!
+	 * @brief Getter method for the number of different fingerprints.
+	 */
+	std::size_t size() const;
+};
+
+#endif /* FINGERPRINTSET_H_ */
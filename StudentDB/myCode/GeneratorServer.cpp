@@ -0,0 +1,214 @@
+/*!
+ * @file GeneratorServer.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "GeneratorServer.h"
+
+#include <atomic>
+#include <thread>
+
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+#include <Poco/Net/TCPServerParams.h>
+
+using namespace std;
+
+/*!
+ * @brief Serves the requests of one client connection.
+ */
+class GeneratorConnection : public Poco::Net::TCPServerConnection
+{
+private:
+	/*!
+	 * @var m_random - The generator of the data of this connection.
+	 */
+	mt19937 m_random;
+
+	/*!
+	 * @var m_latencyMs - Delay before every response, in milliseconds.
+	 */
+	unsigned int m_latencyMs;
+
+public:
+	GeneratorConnection(const Poco::Net::StreamSocket& socket,
+			unsigned int seed, unsigned int latencyMs) :
+				Poco::Net::TCPServerConnection(socket),
+				m_random(seed), m_latencyMs(latencyMs)
+	{
+	}
+
+	void run() override
+	{
+		Poco::Net::SocketStream stream(this->socket());
+
+		string request;
+
+		//! The original client sends "generate" without a line end and shuts down.
+		while(getline(stream, request))
+		{
+			if(!request.empty() && request.back() == '\r')
+			{
+				request.pop_back();
+			}
+
+			if(request == "generate")
+			{
+				if(this->m_latencyMs > 0)
+				{
+					this_thread::sleep_for(chrono::milliseconds(this->m_latencyMs));
+				}
+
+				stream << "100 Generating\n"
+						<< GeneratorServer::generateRecord(this->m_random) << "\n"
+						<< "200 Data generated.\n";
+			}
+			else if(request == "quit")
+			{
+				stream << "221 Bye\n";
+				stream.flush();
+				break;
+			}
+			else if(!request.empty())
+			{
+				stream << "400 Unknown command\n";
+			}
+
+			//! Answers are sent once the pipelined requests received so far are done.
+			if(stream.rdbuf()->in_avail() == 0)
+			{
+				stream.flush();
+			}
+		}
+
+		stream.flush();
+	}
+};
+
+/*!
+ * @brief Creates the GeneratorConnection objects, each with its own seed.
+ */
+class GeneratorConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+{
+private:
+	/*!
+	 * @var m_seed - Seed of the server.
+	 */
+	unsigned int m_seed;
+
+	/*!
+	 * @var m_latencyMs - Delay before every response, in milliseconds.
+	 */
+	unsigned int m_latencyMs;
+
+	/*!
+	 * @var m_noOfConnections - Number of connections created so far.
+	 */
+	atomic<unsigned int> m_noOfConnections;
+
+public:
+	GeneratorConnectionFactory(unsigned int seed, unsigned int latencyMs) :
+		m_seed(seed), m_latencyMs(latencyMs), m_noOfConnections(0)
+	{
+	}
+
+	Poco::Net::TCPServerConnection* createConnection(
+			const Poco::Net::StreamSocket& socket) override
+	{
+		return new GeneratorConnection(socket, this->m_seed + this->m_noOfConnections++,
+				this->m_latencyMs);
+	}
+};
+
+GeneratorServer::GeneratorServer(unsigned short port, unsigned int seed,
+		unsigned int latencyMs, unsigned int maxThreads)
+{
+	Poco::Net::ServerSocket serverSocket(Poco::Net::SocketAddress("127.0.0.1", port));
+
+	this->m_port = serverSocket.address().port();
+
+	Poco::Net::TCPServerParams::Ptr params = new Poco::Net::TCPServerParams;
+
+	params->setMaxThreads(maxThreads);
+	params->setMaxQueued(maxThreads * 4);
+
+	this->m_server.reset(new Poco::Net::TCPServer(
+			new GeneratorConnectionFactory(seed, latencyMs), serverSocket, params));
+
+	this->m_server->start();
+}
+
+GeneratorServer::~GeneratorServer()
+{
+	this->m_server->stop();
+}
+
+unsigned short GeneratorServer::getPort() const
+{
+	return this->m_port;
+}
+
+std::string GeneratorServer::generateRecord(std::mt19937 &random)
+{
+	static const vector<string> titles = {"Mr", "Ms", "Mrs", "Dr"};
+	static const vector<string> firstNames = {"Tobias", "Anna", "Lukas", "Lea",
+			"Jonas", "Mia", "Felix", "Emma", "J\\u00fcrgen", "Zo\\u00eb"};
+	static const vector<string> lastNames = {"M\\u00fcller", "Schmidt", "Schneider",
+			"Fischer", "Weber", "Meyer", "Wagner", "Becker", "Schulz", "Hoffmann"};
+	static const vector<string> streets = {"Hauptstra\\u00dfe", "Schulstra\\u00dfe",
+			"Am Karlshof", "Rheinstra\\u00dfe", "Bahnhofstra\\u00dfe", "Gartenweg"};
+	static const vector<string> cities = {"Darmstadt", "Frankfurt", "Mainz",
+			"Wiesbaden", "Offenbach", "K\\u00f6ln"};
+	static const vector<string> states = {"Hessen", "Rheinland-Pfalz",
+			"Nordrhein-Westfalen", "Bayern"};
+
+	auto pick = [&random](const vector<string>& values) -> const string&
+	{
+		return values[uniform_int_distribution<size_t>(0, values.size() - 1)(random)];
+	};
+
+	string title = pick(titles);
+	string firstName = pick(firstNames);
+	string lastName = pick(lastNames);
+	unsigned int year = uniform_int_distribution<unsigned int>(60, 105)(random);
+	unsigned int month = uniform_int_distribution<unsigned int>(0, 11)(random);
+	unsigned int day = uniform_int_distribution<unsigned int>(1, 28)(random);
+	string street = pick(streets);
+	unsigned int houseNumber = uniform_int_distribution<unsigned int>(1, 200)(random);
+	//! Address keeps the postal code as an unsigned short.
+	unsigned int postCode = uniform_int_distribution<unsigned int>(10000, 65535)(random);
+	string city = pick(cities);
+	string state = pick(states);
+
+	ostringstream record;
+
+	record << R"({"name":{"title":")" << title
+			<< R"(","firstName":")" << firstName
+			<< R"(","lastName":")" << lastName
+			<< R"("},"location":{"street":")" << street << " " << houseNumber
+			<< R"(","postCode":)" << postCode
+			<< R"(,"city":")" << city
+			<< R"(","state":")" << state
+			<< R"("},"dateOfBirth":{"year":)" << year
+			<< R"(,"month":)" << month
+			<< R"(,"date":)" << day
+			<< R"(},"email":"student)" << postCode << houseNumber << R"(@example.com"})";
+
+	return record.str();
+}
+
+void GeneratorServer::writeResponses(std::ostream &out, unsigned int noOfResponses,
+		unsigned int seed)
+{
+	mt19937 random(seed);
+
+	for(unsigned int idx = 0; idx < noOfResponses; idx++)
+	{
+		out << "100 Generating\n" << generateRecord(random) << "\n"
+				<< "200 Data generated.\n";
+	}
+}
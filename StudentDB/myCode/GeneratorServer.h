@@ -0,0 +1,92 @@
+/*!
+ * @file GeneratorServer.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef GENERATORSERVER_H_
+#define GENERATORSERVER_H_
+
+#include <memory>
+#include <random>
+
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/TCPServer.h>
+
+#include "helperFunctions.h"
+
+/*!
+ * @class GeneratorServer
+ * @brief A local stand-in for the student data generator server.
+ *
+ * Speaks the protocol of www.hhs.users.h-da.cloud:4242: every "generate"
+ * line is answered with the line "100 Generating", one line of JSON data
+ * with the "name", "dateOfBirth" and "location" objects and the line
+ * "200 Data generated.". "quit" ends the connection. The data of every
+ * connection comes from a random generator seeded with the server seed
+ * and the number of the connection, so runs are reproducible.
+ */
+class GeneratorServer
+{
+private:
+	/*!
+	 * @var m_server - Accepts the connections and serves them on its threads.
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> m_server;
+
+	/*!
+	 * @var m_port - The port the server listens on.
+	 */
+	unsigned short m_port;
+
+public:
+	/*!
+	 * @brief Creates the server and starts listening on localhost.
+	 *
+	 * @param port The port to listen on, 0 picks a free port.
+	 * @param seed Seed of the generated data.
+	 * @param latencyMs Delay before every response, in milliseconds.
+	 * @param maxThreads Maximum number of connections served in parallel.
+	 */
+	GeneratorServer(unsigned short port, unsigned int seed,
+			unsigned int latencyMs = 0, unsigned int maxThreads = 32);
+
+	/*!
+	 * @brief Stops the server.
+	 */
+	~GeneratorServer();
+
+	/*!
+	 * @brief Getter method to obtain the port the server listens on.
+	 *
+	 * @return The port.
+	 */
+	unsigned short getPort() const;
+
+	/*!
+	 * @brief Generates the JSON data of one response.
+	 *
+	 * Like the real server, some names and places contain escaped
+	 * non-ASCII characters, which the client rejects.
+	 *
+	 * @param random The random generator of the connection.
+	 * @return One line of JSON data, without the line end.
+	 */
+	static std::string generateRecord(std::mt19937& random);
+
+	/*!
+	 * @brief Writes generated responses in the format captured from
+	 * the server, three lines per response.
+	 *
+	 * @param out The output stream for the responses.
+	 * @param noOfResponses Number of responses to be written.
+	 * @param seed Seed of the generated data.
+	 */
+	static void writeResponses(std::ostream& out, unsigned int noOfResponses,
+			unsigned int seed);
+};
+
+#endif /* GENERATORSERVER_H_ */
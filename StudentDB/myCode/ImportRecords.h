@@ -0,0 +1,50 @@
+/*!
+ * @file ImportRecords.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef IMPORTRECORDS_H_
+#define IMPORTRECORDS_H_
+
+#include <string>
+#include <vector>
+
+#include "helperFunctions.h"
+
+/*!
+ * @struct EnrollmentRecord
+ * @brief Plain, already parsed enrollment data as read from an import source.
+ *
+ * The course is referenced by its key only, it is resolved against
+ * the courses of the database when the record is inserted.
+ */
+struct EnrollmentRecord
+{
+	unsigned int courseKey = 0;		///< Key of the enrolled course.
+	std::string semester;			///< Semester of the enrollment.
+	float grade = 0.0;				///< Grade of the enrollment.
+};
+
+/*!
+ * @struct StudentRecord
+ * @brief Plain, already parsed student data including the address
+ * and the enrollments, as read from an import source.
+ */
+struct StudentRecord
+{
+	unsigned int matrikelNumber = 0;		///< Matrikel number of the student.
+	std::string firstName;					///< First name of the student.
+	std::string lastName;					///< Last name of the student.
+	Poco::Data::Date dateOfBirth;			///< Date of birth of the student.
+	std::string street;						///< Street of the address.
+	unsigned short postalCode = 0;			///< Postal code of the address.
+	std::string cityName;					///< City name of the address.
+	std::string additionalInfo;				///< Additional info of the address.
+	std::vector<EnrollmentRecord> enrollments;	///< Enrollments of the student.
+};
+
+#endif /* IMPORTRECORDS_H_ */
@@ -0,0 +1,338 @@
+/*!
+ * @file IngestionMetrics.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "IngestionMetrics.h"
+
+#include <iomanip>
+
+#include <Poco/JSON/Array.h>
+#include <Poco/JSON/Stringifier.h>
+
+#include "ServerRecordScanner.h"
+
+using namespace std;
+
+LatencyHistogram::LatencyHistogram()
+{
+	this->reset();
+}
+
+void LatencyHistogram::reset()
+{
+	for(atomic<Poco::UInt64>& bucket : this->m_buckets)
+	{
+		bucket = 0;
+	}
+
+	this->m_count = 0;
+	this->m_sumNs = 0;
+	this->m_maxNs = 0;
+}
+
+void LatencyHistogram::record(std::chrono::nanoseconds duration)
+{
+	Poco::UInt64 durationNs = max<chrono::nanoseconds::rep>(duration.count(), 0);
+
+	unsigned int bucketIdx = 0;
+
+	while(bucketIdx < noOfBuckets - 1 && (durationNs >> (bucketIdx + 1)) != 0)
+	{
+		bucketIdx++;
+	}
+
+	this->m_buckets[bucketIdx]++;
+	this->m_count++;
+	this->m_sumNs += durationNs;
+
+	Poco::UInt64 maxNs = this->m_maxNs.load();
+
+	while(durationNs > maxNs && !this->m_maxNs.compare_exchange_weak(maxNs, durationNs))
+	{
+	}
+}
+
+Poco::UInt64 LatencyHistogram::getCount() const
+{
+	return this->m_count.load();
+}
+
+Poco::UInt64 LatencyHistogram::getSumNs() const
+{
+	return this->m_sumNs.load();
+}
+
+Poco::UInt64 LatencyHistogram::getMaxNs() const
+{
+	return this->m_maxNs.load();
+}
+
+Poco::UInt64 LatencyHistogram::getBucket(unsigned int bucketIdx) const
+{
+	return this->m_buckets.at(bucketIdx).load();
+}
+
+Poco::UInt64 LatencyHistogram::percentileNs(double fraction) const
+{
+	Poco::UInt64 count = this->getCount();
+
+	if(count == 0)
+	{
+		return 0;
+	}
+
+	Poco::UInt64 rank = static_cast<Poco::UInt64>(fraction * count);
+
+	Poco::UInt64 seen = 0;
+
+	for(unsigned int bucketIdx = 0; bucketIdx < noOfBuckets; bucketIdx++)
+	{
+		seen += this->getBucket(bucketIdx);
+
+		if(seen > rank)
+		{
+			//! The last bucket is open ended, its bound is the longest duration.
+			return (bucketIdx == noOfBuckets - 1) ? this->getMaxNs()
+					: min(Poco::UInt64(1) << (bucketIdx + 1), this->getMaxNs());
+		}
+	}
+
+	return this->getMaxNs();
+}
+
+IngestionMetrics::IngestionMetrics() : m_requested(0), m_received(0), m_valid(0),
+		m_malformed(0), m_rejected(0), m_inserted(0), m_duplicates(0),
+		m_timeouts(0), m_connectionErrors(0)
+{
+}
+
+void IngestionMetrics::start(const std::string &mode, unsigned int noOfRequested)
+{
+	this->m_mode = mode;
+	this->m_requested = noOfRequested;
+
+	this->m_connect.reset();
+	this->m_request.reset();
+	this->m_parse.reset();
+	this->m_insert.reset();
+
+	this->m_received = 0;
+	this->m_valid = 0;
+	this->m_malformed = 0;
+	this->m_rejected = 0;
+	this->m_inserted = 0;
+	this->m_duplicates = 0;
+	this->m_timeouts = 0;
+	this->m_connectionErrors = 0;
+
+	this->m_start = chrono::steady_clock::now();
+	this->m_finish = this->m_start;
+}
+
+void IngestionMetrics::finish()
+{
+	this->m_finish = chrono::steady_clock::now();
+}
+
+void IngestionMetrics::recordConnect(std::chrono::nanoseconds duration)
+{
+	this->m_connect.record(duration);
+}
+
+void IngestionMetrics::recordRequest(std::chrono::nanoseconds duration)
+{
+	this->m_request.record(duration);
+}
+
+void IngestionMetrics::recordParse(std::chrono::nanoseconds duration)
+{
+	this->m_parse.record(duration);
+}
+
+bool IngestionMetrics::scanRecord(const std::string &jsonLine, StudentRecord &record)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	ServerRecordScanner::ScanResult_t result = ServerRecordScanner::scan(jsonLine, record);
+
+	this->m_parse.record(chrono::steady_clock::now() - start);
+
+	this->m_received++;
+
+	switch(result)
+	{
+	case ServerRecordScanner::ScanResult_t::SR_Valid: this->m_valid++; break;
+	case ServerRecordScanner::ScanResult_t::SR_Rejected: this->m_rejected++; break;
+	case ServerRecordScanner::ScanResult_t::SR_Malformed: this->m_malformed++; break;
+	}
+
+	return result == ServerRecordScanner::ScanResult_t::SR_Valid;
+}
+
+void IngestionMetrics::countReceived()
+{
+	this->m_received++;
+}
+
+void IngestionMetrics::countValid()
+{
+	this->m_valid++;
+}
+
+void IngestionMetrics::countMalformed()
+{
+	this->m_malformed++;
+}
+
+void IngestionMetrics::countRejected()
+{
+	this->m_rejected++;
+}
+
+void IngestionMetrics::recordInsert(unsigned int noOfRecords, unsigned int inserted,
+		std::chrono::nanoseconds duration)
+{
+	this->m_insert.record(duration);
+
+	this->m_inserted += inserted;
+	this->m_duplicates += noOfRecords - inserted;
+}
+
+void IngestionMetrics::countError(const std::exception &error)
+{
+	if(dynamic_cast<const Poco::TimeoutException*>(&error) != nullptr)
+	{
+		this->m_timeouts++;
+	}
+	else
+	{
+		this->m_connectionErrors++;
+	}
+}
+
+unsigned int IngestionMetrics::getReceived() const
+{
+	return this->m_received.load();
+}
+
+unsigned int IngestionMetrics::getInserted() const
+{
+	return this->m_inserted.load();
+}
+
+double IngestionMetrics::getSeconds() const
+{
+	chrono::steady_clock::time_point end = (this->m_finish > this->m_start)
+			? this->m_finish : chrono::steady_clock::now();
+
+	return chrono::duration<double>(end - this->m_start).count();
+}
+
+double IngestionMetrics::getRecordsPerSecond() const
+{
+	return this->getReceived() / max(this->getSeconds(), 1e-9);
+}
+
+void IngestionMetrics::writeSummary(std::ostream &out) const
+{
+	auto writeLatency = [&out](const string& name, const LatencyHistogram& histogram)
+	{
+		Poco::UInt64 count = histogram.getCount();
+
+		out << "\t " << name << ": " << count << " x";
+
+		if(count > 0)
+		{
+			out << ", mean " << histogram.getSumNs() / 1e3 / count
+					<< " us, p50 " << histogram.percentileNs(0.50) / 1e3
+					<< " us, p90 " << histogram.percentileNs(0.90) / 1e3
+					<< " us, p99 " << histogram.percentileNs(0.99) / 1e3
+					<< " us, max " << histogram.getMaxNs() / 1e3 << " us";
+		}
+
+		out << endl;
+	};
+
+	ios::fmtflags flags = out.flags();
+	streamsize precision = out.precision();
+
+	out << fixed << setprecision(1);
+	out << "Ingestion metrics (" << this->m_mode << "): " << this->getReceived()
+			<< " of " << this->m_requested << " responses in "
+			<< setprecision(3) << this->getSeconds() << " s, "
+			<< setprecision(1) << this->getRecordsPerSecond() << " records/s" << endl;
+	out << "\t valid " << this->m_valid.load() << ", malformed " << this->m_malformed.load()
+			<< ", rejected " << this->m_rejected.load() << ", duplicates "
+			<< this->m_duplicates.load() << ", added " << this->getInserted() << endl;
+	out << "\t timeouts " << this->m_timeouts.load() << ", connection errors "
+			<< this->m_connectionErrors.load() << endl;
+
+	writeLatency("connect", this->m_connect);
+	writeLatency("request", this->m_request);
+	writeLatency("parse  ", this->m_parse);
+	writeLatency("insert ", this->m_insert);
+
+	out.flags(flags);
+	out.precision(precision);
+}
+
+void IngestionMetrics::writeJson(std::ostream &out) const
+{
+	auto latencyJson = [](const LatencyHistogram& histogram)
+	{
+		Poco::JSON::Object::Ptr latency = new Poco::JSON::Object;
+
+		Poco::JSON::Array::Ptr buckets = new Poco::JSON::Array;
+
+		for(unsigned int bucketIdx = 0; bucketIdx < LatencyHistogram::noOfBuckets; bucketIdx++)
+		{
+			buckets->add(histogram.getBucket(bucketIdx));
+		}
+
+		latency->set("count", histogram.getCount());
+		latency->set("sumNs", histogram.getSumNs());
+		latency->set("maxNs", histogram.getMaxNs());
+		latency->set("p50Ns", histogram.percentileNs(0.50));
+		latency->set("p90Ns", histogram.percentileNs(0.90));
+		latency->set("p99Ns", histogram.percentileNs(0.99));
+		latency->set("log2Buckets", buckets);
+
+		return latency;
+	};
+
+	Poco::JSON::Object::Ptr counters = new Poco::JSON::Object;
+
+	counters->set("requested", this->m_requested);
+	counters->set("received", this->getReceived());
+	counters->set("valid", this->m_valid.load());
+	counters->set("malformed", this->m_malformed.load());
+	counters->set("rejected", this->m_rejected.load());
+	counters->set("duplicates", this->m_duplicates.load());
+	counters->set("inserted", this->getInserted());
+	counters->set("timeouts", this->m_timeouts.load());
+	counters->set("connectionErrors", this->m_connectionErrors.load());
+
+	Poco::JSON::Object::Ptr latencies = new Poco::JSON::Object;
+
+	latencies->set("connect", latencyJson(this->m_connect));
+	latencies->set("request", latencyJson(this->m_request));
+	latencies->set("parse", latencyJson(this->m_parse));
+	latencies->set("insert", latencyJson(this->m_insert));
+
+	Poco::JSON::Object metrics;
+
+	metrics.set("mode", this->m_mode);
+	metrics.set("seconds", this->getSeconds());
+	metrics.set("recordsPerSecond", this->getRecordsPerSecond());
+	metrics.set("counters", counters);
+	metrics.set("latencies", latencies);
+
+	metrics.stringify(out);
+
+	out << endl;
+}
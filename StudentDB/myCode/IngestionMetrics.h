@@ -0,0 +1,245 @@
+/*!
+ * @file IngestionMetrics.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef INGESTIONMETRICS_H_
+#define INGESTIONMETRICS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "ImportRecords.h"
+
+/*!
+ * @class LatencyHistogram
+ * @brief Counts durations in buckets of powers of two nanoseconds.
+ *
+ * Bucket i holds the durations from 2^i up to 2^(i+1) nanoseconds.
+ * Recording is lock-free, so every thread of a run can record into
+ * the same histogram.
+ */
+class LatencyHistogram
+{
+public:
+	/*!
+	 * @brief Number of buckets, the last one also holds all longer durations.
+	 */
+	static const unsigned int noOfBuckets = 40;
+
+private:
+	/*!
+	 * @var m_buckets - Number of durations per bucket.
+	 */
+	std::array<std::atomic<Poco::UInt64>, noOfBuckets> m_buckets;
+
+	/*!
+	 * @var m_count - Number of recorded durations.
+	 */
+	std::atomic<Poco::UInt64> m_count;
+
+	/*!
+	 * @var m_sumNs - Sum of the recorded durations in nanoseconds.
+	 */
+	std::atomic<Poco::UInt64> m_sumNs;
+
+	/*!
+	 * @var m_maxNs - Longest recorded duration in nanoseconds.
+	 */
+	std::atomic<Poco::UInt64> m_maxNs;
+
+public:
+	/*!
+	 * @brief Constructor of an empty histogram.
+	 */
+	LatencyHistogram();
+
+	/*!
+	 * @brief Removes all recorded durations.
+	 */
+	void reset();
+
+	/*!
+	 * @brief Records one duration.
+	 */
+	void record(std::chrono::nanoseconds duration);
+
+	/*!
+	 * @brief Getter methods for the recorded durations.
+	 */
+	Poco::UInt64 getCount() const;
+	Poco::UInt64 getSumNs() const;
+	Poco::UInt64 getMaxNs() const;
+	Poco::UInt64 getBucket(unsigned int bucketIdx) const;
+
+	/*!
+	 * @brief Estimates a percentile of the recorded durations.
+	 *
+	 * @param fraction The percentile as fraction, e.g. 0.99.
+	 * @return The upper bound of the bucket holding the percentile,
+	 * in nanoseconds, 0 if nothing was recorded.
+	 */
+	Poco::UInt64 percentileNs(double fraction) const;
+};
+
+/*!
+ * @class IngestionMetrics
+ * @brief Instrumentation of one run of a server ingestion.
+ *
+ * Holds the latency histograms of connecting, of the requests from
+ * sending to receiving the JSON data, of parsing and of inserting,
+ * and the counters of the responses and their outcome. All methods
+ * that record may be called from several threads at once. The run is
+ * reported as a summary for people and as a JSON dump for tools.
+ */
+class IngestionMetrics
+{
+private:
+	/*!
+	 * @var m_mode - Description of the ingestion mode of the run.
+	 */
+	std::string m_mode;
+
+	/*!
+	 * @var m_start, m_finish - Start and end of the run.
+	 */
+	std::chrono::steady_clock::time_point m_start;
+	std::chrono::steady_clock::time_point m_finish;
+
+	/*!
+	 * @var m_connect, m_request, m_parse, m_insert - The latency histograms.
+	 * m_insert holds the time per inserted batch.
+	 */
+	LatencyHistogram m_connect;
+	LatencyHistogram m_request;
+	LatencyHistogram m_parse;
+	LatencyHistogram m_insert;
+
+	/*!
+	 * @var m_requested - Number of responses requested by the run.
+	 */
+	unsigned int m_requested;
+
+	/*!
+	 * @var m_received, m_valid, m_malformed, m_rejected - Responses
+	 * received, and how many of them were valid, malformed JSON
+	 * or rejected by the validation.
+	 */
+	std::atomic<unsigned int> m_received;
+	std::atomic<unsigned int> m_valid;
+	std::atomic<unsigned int> m_malformed;
+	std::atomic<unsigned int> m_rejected;
+
+	/*!
+	 * @var m_inserted, m_duplicates - Valid records added to the
+	 * database and skipped as duplicates.
+	 */
+	std::atomic<unsigned int> m_inserted;
+	std::atomic<unsigned int> m_duplicates;
+
+	/*!
+	 * @var m_timeouts, m_connectionErrors - Connections ended by a
+	 * timeout and by any other error.
+	 */
+	std::atomic<unsigned int> m_timeouts;
+	std::atomic<unsigned int> m_connectionErrors;
+
+	/*!
+	 * @brief Duration of the run in seconds, up to now if it is not finished.
+	 */
+	double getSeconds() const;
+
+public:
+	/*!
+	 * @brief Constructor of the metrics of a run not yet started.
+	 */
+	IngestionMetrics();
+
+	/*!
+	 * @brief Resets all metrics and starts a run.
+	 *
+	 * @param mode Description of the ingestion mode.
+	 * @param noOfRequested Number of responses to be requested.
+	 */
+	void start(const std::string& mode, unsigned int noOfRequested);
+
+	/*!
+	 * @brief Ends the run.
+	 */
+	void finish();
+
+	/*!
+	 * @brief Records the latencies of the run.
+	 */
+	void recordConnect(std::chrono::nanoseconds duration);
+	void recordRequest(std::chrono::nanoseconds duration);
+	void recordParse(std::chrono::nanoseconds duration);
+
+	/*!
+	 * @brief Scans one response with ServerRecordScanner and records
+	 * the parse latency and the outcome.
+	 *
+	 * @param jsonLine The JSON line of the response.
+	 * @param record Receives the student data.
+	 * @return True if the record is valid.
+	 */
+	bool scanRecord(const std::string& jsonLine, StudentRecord& record);
+
+	/*!
+	 * @brief Counts the outcome of one response that was parsed by
+	 * other means than scanRecord().
+	 */
+	void countReceived();
+	void countValid();
+	void countMalformed();
+	void countRejected();
+
+	/*!
+	 * @brief Records the insertion of one batch of valid records.
+	 *
+	 * @param noOfRecords Number of records in the batch.
+	 * @param inserted Number of records added, the others were duplicates.
+	 * @param duration Time taken by the insertion.
+	 */
+	void recordInsert(unsigned int noOfRecords, unsigned int inserted,
+			std::chrono::nanoseconds duration);
+
+	/*!
+	 * @brief Counts a connection ended by an error, Poco::TimeoutException
+	 * counts as timeout.
+	 */
+	void countError(const std::exception& error);
+
+	/*!
+	 * @brief Getter methods for the counters of the run.
+	 */
+	unsigned int getReceived() const;
+	unsigned int getInserted() const;
+
+	/*!
+	 * @brief Received responses per second of the run.
+	 */
+	double getRecordsPerSecond() const;
+
+	/*!
+	 * @brief Prints a summary of the run.
+	 *
+	 * @param out The output stream for the summary.
+	 */
+	void writeSummary(std::ostream& out) const;
+
+	/*!
+	 * @brief Writes all metrics of the run as one JSON object,
+	 * durations in nanoseconds.
+	 *
+	 * @param out The output stream for the JSON data.
+	 */
+	void writeJson(std::ostream& out) const;
+};
+
+#endif /* INGESTIONMETRICS_H_ */
@@ -0,0 +1,73 @@
+/*!
+ * @file JsonFieldReader.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "JsonFieldReader.h"
+
+using namespace std;
+
+void readJsonValue(const Poco::Dynamic::Var &value, std::string &target)
+{
+	if(value.type() == typeid(string))
+	{
+		target = value.extract<string>();
+	}
+	else
+	{
+		target = value.toString();
+	}
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, int &target)
+{
+	value.convert(target);
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, unsigned int &target)
+{
+	value.convert(target);
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, unsigned short &target)
+{
+	value.convert(target);
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, float &target)
+{
+	value.convert(target);
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, Poco::Data::Date &target)
+{
+	if(value.type() == typeid(string))
+	{
+		target = stringToPocoDateFormatter(value.extract<string>());
+	}
+	else
+	{
+		target = stringToPocoDateFormatter(value.toString());
+	}
+}
+
+void readJsonValue(const Poco::Dynamic::Var &value, Poco::Data::Time &target)
+{
+	if(value.type() == typeid(string))
+	{
+		target = stringToPocoTimeFormatter(value.extract<string>());
+	}
+	else
+	{
+		target = stringToPocoTimeFormatter(value.toString());
+	}
+}
+
+const Poco::JSON::Object& jsonObjectValue(const Poco::Dynamic::Var &value)
+{
+	return *(value.extract<Poco::JSON::Object::Ptr>());
+}
@@ -0,0 +1,89 @@
+/*!
+ * @file JsonFieldReader.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef JSONFIELDREADER_H_
+#define JSONFIELDREADER_H_
+
+#include "helperFunctions.h"
+
+/*!
+ * @brief Typed extraction of a JSON member value into a string.
+ *
+ * String values are copied once, straight out of the parsed object.
+ * Other values are converted to their string representation.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The string that receives the value.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, std::string& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value into an integer.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The integer that receives the value.
+ * @throws Poco::Exception if the value can't be converted.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, int& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value into an unsigned integer.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The unsigned integer that receives the value.
+ * @throws Poco::Exception if the value can't be converted.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, unsigned int& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value into an unsigned short.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The unsigned short that receives the value.
+ * @throws Poco::Exception if the value can't be converted.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, unsigned short& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value into a float.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The float that receives the value.
+ * @throws Poco::Exception if the value can't be converted.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, float& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value holding
+ * a date in the format "dd.mm.YYYY".
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The date that receives the value.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, Poco::Data::Date& target);
+
+/*!
+ * @brief Typed extraction of a JSON member value holding
+ * a time in the format "HH:MM".
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @param target The time that receives the value.
+ */
+void readJsonValue(const Poco::Dynamic::Var& value, Poco::Data::Time& target);
+
+/*!
+ * @brief Returns the nested object held by a JSON member value.
+ *
+ * @param value The member value held by the parsed Poco::JSON::Object.
+ * @return A reference to the nested object, owned by the parsed data.
+ * @throws Poco::BadCastException if the value is not an object.
+ */
+const Poco::JSON::Object& jsonObjectValue(const Poco::Dynamic::Var& value);
+
+#endif /* JSONFIELDREADER_H_ */
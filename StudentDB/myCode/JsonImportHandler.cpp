@@ -0,0 +1,328 @@
+/*!
+ * @file JsonImportHandler.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "JsonImportHandler.h"
+
+using namespace std;
+
+JsonImportHandler::JsonImportHandler(
+		std::function<void(std::unique_ptr<Course>)> onCourse,
+		std::function<void(StudentRecord)> onStudent) :
+				m_onCourse(onCourse), m_onStudent(onStudent), m_courseType(' '),
+				m_blockCourseRead(0), m_weeklyCourseRead(0), m_studentRead(0),
+				m_addressRead(0), m_enrollmentRead(0)
+{
+}
+
+JsonImportHandler::~JsonImportHandler()
+{
+}
+
+JsonImportHandler::Context_t JsonImportHandler::currentContext() const
+{
+	if(this->m_context.empty())
+	{
+		return Context_t::Skip;
+	}
+
+	return this->m_context.back();
+}
+
+void JsonImportHandler::reset()
+{
+	this->m_context.clear();
+	this->m_key.clear();
+}
+
+void JsonImportHandler::startObject()
+{
+	if(this->m_context.empty())
+	{
+		this->m_context.push_back(Context_t::Root);
+		return;
+	}
+
+	switch(this->currentContext())
+	{
+	case Context_t::Root:
+	{
+		if(this->m_key == "course")
+		{
+			this->startCourse();
+		}
+		else if(this->m_key == "student")
+		{
+			this->startStudent();
+		}
+		else
+		{
+			this->m_context.push_back(Context_t::Skip);
+		}
+	}
+	break;
+	case Context_t::CoursesArray:
+	{
+		this->startCourse();
+	}
+	break;
+	case Context_t::StudentsArray:
+	{
+		this->startStudent();
+	}
+	break;
+	case Context_t::Student:
+	{
+		this->m_context.push_back((this->m_key == "address") ?
+				Context_t::Address : Context_t::Skip);
+	}
+	break;
+	case Context_t::EnrollmentsArray:
+	{
+		this->m_enrollmentValues = decltype(this->m_enrollmentValues)();
+		this->m_enrollmentRead = 0;
+		this->m_context.push_back(Context_t::Enrollment);
+	}
+	break;
+	default:
+	{
+		this->m_context.push_back(Context_t::Skip);
+	}
+	break;
+	}
+}
+
+void JsonImportHandler::endObject()
+{
+	Context_t closed = this->currentContext();
+
+	this->m_context.pop_back();
+
+	switch(closed)
+	{
+	case Context_t::Course:
+	{
+		this->endCourse();
+	}
+	break;
+	case Context_t::Student:
+	{
+		//! The address is part of the student, as in the DOM import.
+		checkFieldsRead(this->m_studentRead, studentFields());
+		checkFieldsRead(this->m_addressRead, addressFields());
+
+		StudentRecord& student = this->m_student;
+
+		tie(student.matrikelNumber, student.firstName, student.lastName,
+				student.dateOfBirth) = move(this->m_studentValues);
+
+		//! Handed over, startStudent() resets the record for the next one.
+		this->m_onStudent(move(student));
+	}
+	break;
+	case Context_t::Address:
+	{
+		StudentRecord& student = this->m_student;
+
+		tie(student.street, student.postalCode, student.cityName,
+				student.additionalInfo) = move(this->m_addressValues);
+	}
+	break;
+	case Context_t::Enrollment:
+	{
+		checkFieldsRead(this->m_enrollmentRead, enrollmentFields());
+
+		EnrollmentRecord enrollment;
+
+		tie(enrollment.courseKey, enrollment.semester, enrollment.grade) =
+				move(this->m_enrollmentValues);
+
+		this->m_student.enrollments.push_back(move(enrollment));
+	}
+	break;
+	default:
+	{
+		break;
+	}
+	}
+}
+
+void JsonImportHandler::startArray()
+{
+	Context_t context = this->currentContext();
+
+	if(context == Context_t::Root && this->m_key == "courses")
+	{
+		this->m_context.push_back(Context_t::CoursesArray);
+	}
+	else if(context == Context_t::Root && this->m_key == "students")
+	{
+		this->m_context.push_back(Context_t::StudentsArray);
+	}
+	else if(context == Context_t::Student && this->m_key == "enrollments")
+	{
+		this->m_context.push_back(Context_t::EnrollmentsArray);
+	}
+	else
+	{
+		this->m_context.push_back(Context_t::Skip);
+	}
+}
+
+void JsonImportHandler::endArray()
+{
+	this->m_context.pop_back();
+}
+
+void JsonImportHandler::key(const std::string &k)
+{
+	this->m_key = k;
+}
+
+void JsonImportHandler::null()
+{
+}
+
+void JsonImportHandler::value(int v)
+{
+	this->setField(v);
+}
+
+void JsonImportHandler::value(unsigned v)
+{
+	this->setField(v);
+}
+
+#if defined(POCO_HAVE_INT64)
+void JsonImportHandler::value(Poco::Int64 v)
+{
+	this->setField(v);
+}
+
+void JsonImportHandler::value(Poco::UInt64 v)
+{
+	this->setField(v);
+}
+#endif
+
+void JsonImportHandler::value(const std::string &value)
+{
+	this->setField(value);
+}
+
+void JsonImportHandler::value(double d)
+{
+	this->setField(d);
+}
+
+void JsonImportHandler::value(bool b)
+{
+	this->setField(b);
+}
+
+void JsonImportHandler::startCourse()
+{
+	this->m_courseType = ' ';
+	this->m_blockCourse = decltype(this->m_blockCourse)();
+	this->m_weeklyCourse = decltype(this->m_weeklyCourse)();
+	this->m_blockCourseRead = 0;
+	this->m_weeklyCourseRead = 0;
+
+	this->m_context.push_back(Context_t::Course);
+}
+
+void JsonImportHandler::endCourse()
+{
+	unique_ptr<Course> course;
+
+	if(this->m_courseType == ' ')
+	{
+		throw Poco::NotFoundException("Incomplete JSON data");
+	}
+
+	if(this->m_courseType == 'B' || this->m_courseType == 'b')
+	{
+		checkFieldsRead(this->m_blockCourseRead, blockCourseFields());
+
+		course = applyValues([](auto&&... fields)
+				{ return make_unique<BlockCourse>(forward<decltype(fields)>(fields)...); },
+				this->m_blockCourse);
+	}
+	else if(this->m_courseType == 'W' || this->m_courseType == 'w')
+	{
+		checkFieldsRead(this->m_weeklyCourseRead, weeklyCourseFields());
+
+		course = applyValues([](auto&&... fields)
+				{ return make_unique<WeeklyCourse>(forward<decltype(fields)>(fields)...); },
+				this->m_weeklyCourse);
+	}
+
+	//! Courses of an unknown type are skipped.
+	if(course != nullptr)
+	{
+		this->m_onCourse(move(course));
+	}
+}
+
+void JsonImportHandler::startStudent()
+{
+	this->m_student = StudentRecord();
+	this->m_studentValues = decltype(this->m_studentValues)();
+	this->m_addressValues = decltype(this->m_addressValues)();
+	this->m_studentRead = 0;
+	this->m_addressRead = 0;
+
+	this->m_context.push_back(Context_t::Student);
+}
+
+void JsonImportHandler::setField(const Poco::Dynamic::Var &value)
+{
+	const string& key = this->m_key;
+
+	switch(this->currentContext())
+	{
+	case Context_t::Course:
+	{
+		if(key == "courseType")
+		{
+			string courseType = value.toString();
+			this->m_courseType = courseType.empty() ? ' ' : courseType[0];
+		}
+		else
+		{
+			readFieldJson(key, value, blockCourseFields(), this->m_blockCourse,
+					this->m_blockCourseRead);
+			readFieldJson(key, value, weeklyCourseFields(), this->m_weeklyCourse,
+					this->m_weeklyCourseRead);
+		}
+	}
+	break;
+	case Context_t::Student:
+	{
+		readFieldJson(key, value, studentFields(), this->m_studentValues,
+				this->m_studentRead);
+	}
+	break;
+	case Context_t::Address:
+	{
+		readFieldJson(key, value, addressFields(), this->m_addressValues,
+				this->m_addressRead);
+	}
+	break;
+	case Context_t::Enrollment:
+	{
+		readFieldJson(key, value, enrollmentFields(), this->m_enrollmentValues,
+				this->m_enrollmentRead);
+	}
+	break;
+	default:
+	{
+		break;
+	}
+	}
+}
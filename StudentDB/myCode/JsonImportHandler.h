@@ -0,0 +1,189 @@
+/*!
+ * @file JsonImportHandler.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef JSONIMPORTHANDLER_H_
+#define JSONIMPORTHANDLER_H_
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <Poco/JSON/Handler.h>
+
+#include "ImportRecords.h"
+#include "ModelFields.h"
+
+/*!
+ * @class JsonImportHandler
+ * @brief Streaming (SAX style) handler for the JSON formats written by
+ * StudentDb::toJson() and StudentDb::writeJsonLines().
+ *
+ * The handler receives the parse events from Poco::JSON::Parser and decodes
+ * each member with the field descriptors of ModelFields.h, so the JSON keys
+ * are the ones written by toJson(). As soon as a course or a student object
+ * is closed, the course or the StudentRecord is handed over to the respective
+ * callback, so no JSON object tree is built. Like readFieldsJson(), an
+ * object that misses one of its fields is rejected with an exception.
+ *
+ * Besides the "courses" and "students" arrays of a complete document, a
+ * top level object may hold a single "course" or "student" object, which
+ * is the form of each line in the JSON Lines format.
+ */
+class JsonImportHandler: public Poco::JSON::Handler
+{
+private:
+	/*!
+	 * @brief Position of the parser in the document.
+	 */
+	enum class Context_t
+	{
+		Root,				///< The top level object.
+		CoursesArray,		///< The "courses" array.
+		Course,				///< An object in the "courses" array.
+		StudentsArray,		///< The "students" array.
+		Student,			///< An object in the "students" array.
+		Address,			///< The "address" object of a student.
+		EnrollmentsArray,	///< The "enrollments" array of a student.
+		Enrollment,			///< An object in the "enrollments" array.
+		Skip				///< Any object or array not known to the handler.
+	};
+
+	/*!
+	 * @var m_onCourse - Called with each completely parsed course.
+	 */
+	std::function<void(std::unique_ptr<Course>)> m_onCourse;
+
+	/*!
+	 * @var m_onStudent - Called with each completely parsed student.
+	 */
+	std::function<void(StudentRecord)> m_onStudent;
+
+	/*!
+	 * @var m_context - Stack of the objects and arrays currently open.
+	 */
+	std::vector<Context_t> m_context;
+
+	/*!
+	 * @var m_key - The key of the last member name reported by the parser.
+	 */
+	std::string m_key;
+
+	/*!
+	 * @var m_courseType - The "courseType" of the course currently being
+	 * read, selects the block or the weekly course values.
+	 */
+	char m_courseType;
+
+	/*!
+	 * @var m_blockCourse, m_weeklyCourse - The values of the course
+	 * currently being read, decoded for both course types since the
+	 * "courseType" member may come last.
+	 */
+	FieldValuesOf<decltype(blockCourseFields())>::type m_blockCourse;
+	FieldValuesOf<decltype(weeklyCourseFields())>::type m_weeklyCourse;
+
+	/*!
+	 * @var m_studentValues - The values of the student currently being read.
+	 */
+	FieldValuesOf<decltype(studentFields())>::type m_studentValues;
+
+	/*!
+	 * @var m_addressValues - The values of the address currently being read.
+	 */
+	FieldValuesOf<decltype(addressFields())>::type m_addressValues;
+
+	/*!
+	 * @var m_enrollmentValues - The values of the enrollment currently being read.
+	 */
+	FieldValuesOf<decltype(enrollmentFields())>::type m_enrollmentValues;
+
+	/*!
+	 * @var m_blockCourseRead, m_weeklyCourseRead, m_studentRead,
+	 * m_addressRead, m_enrollmentRead - The fields read of the objects
+	 * currently being read, see allFieldsMask().
+	 */
+	std::uint32_t m_blockCourseRead;
+	std::uint32_t m_weeklyCourseRead;
+	std::uint32_t m_studentRead;
+	std::uint32_t m_addressRead;
+	std::uint32_t m_enrollmentRead;
+
+	/*!
+	 * @var m_student - The student record currently being filled.
+	 */
+	StudentRecord m_student;
+
+private:
+	/*!
+	 * @brief Returns the innermost open context.
+	 *
+	 * @return The current context, Skip if nothing is open.
+	 */
+	Context_t currentContext() const;
+
+	/*!
+	 * @brief Stores a scalar value in the values selected by
+	 * the current context and the last key.
+	 *
+	 * @param value The value reported by the parser.
+	 */
+	void setField(const Poco::Dynamic::Var& value);
+
+	/*!
+	 * @brief Opens a course object.
+	 */
+	void startCourse();
+
+	/*!
+	 * @brief Creates the course of the closed course object and hands
+	 * it over to the course callback.
+	 *
+	 * @throws Poco::NotFoundException if a field of the course is missing.
+	 */
+	void endCourse();
+
+	/*!
+	 * @brief Opens a student object.
+	 */
+	void startStudent();
+
+public:
+	/*!
+	 * @brief Parameterized constructor for JsonImportHandler.
+	 *
+	 * @param onCourse Called with each completely parsed course.
+	 * @param onStudent Called with each completely parsed student.
+	 */
+	JsonImportHandler(std::function<void(std::unique_ptr<Course>)> onCourse,
+			std::function<void(StudentRecord)> onStudent);
+
+	/*!
+	 * @brief Default destructor for the JsonImportHandler class.
+	 */
+	virtual ~JsonImportHandler();
+
+	void reset() override;
+	void startObject() override;
+	void endObject() override;
+	void startArray() override;
+	void endArray() override;
+	void key(const std::string& k) override;
+	void null() override;
+	void value(int v) override;
+	void value(unsigned v) override;
+#if defined(POCO_HAVE_INT64)
+	void value(Poco::Int64 v) override;
+	void value(Poco::UInt64 v) override;
+#endif
+	void value(const std::string& value) override;
+	void value(double d) override;
+	void value(bool b) override;
+};
+
+#endif /* JSONIMPORTHANDLER_H_ */
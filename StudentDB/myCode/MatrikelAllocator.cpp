@@ -0,0 +1,58 @@
+/*!
+ * @file MatrikelAllocator.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "MatrikelAllocator.h"
+
+#include <algorithm>
+
+using namespace std;
+
+MatrikelAllocator::Block::Block(MatrikelAllocator &allocator, unsigned int blockSize) :
+		m_allocator(allocator), m_blockSize(max(blockSize, 1u)), m_next(0), m_end(0)
+{
+}
+
+unsigned int MatrikelAllocator::Block::allocate()
+{
+	if(this->m_next == this->m_end)
+	{
+		this->m_next = this->m_allocator.reserve(this->m_blockSize);
+		this->m_end = this->m_next + this->m_blockSize;
+	}
+
+	return this->m_next++;
+}
+
+MatrikelAllocator::MatrikelAllocator(unsigned int first) : m_next(first)
+{
+}
+
+unsigned int MatrikelAllocator::allocate()
+{
+	return this->m_next.fetch_add(1);
+}
+
+unsigned int MatrikelAllocator::reserve(unsigned int count)
+{
+	return this->m_next.fetch_add(count);
+}
+
+void MatrikelAllocator::restore(unsigned int usedNumber)
+{
+	unsigned int next = this->m_next.load();
+
+	while(next <= usedNumber && !this->m_next.compare_exchange_weak(next, usedNumber + 1))
+	{
+	}
+}
+
+unsigned int MatrikelAllocator::getNext() const
+{
+	return this->m_next.load();
+}
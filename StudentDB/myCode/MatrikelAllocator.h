@@ -0,0 +1,114 @@
+/*!
+ * @file MatrikelAllocator.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef MATRIKELALLOCATOR_H_
+#define MATRIKELALLOCATOR_H_
+
+#include <atomic>
+
+/*!
+ * @class MatrikelAllocator
+ * @brief Hands out unique matrikel numbers to several threads at once.
+ *
+ * Single numbers are taken with one atomic fetch-add. Bulk loaders take
+ * a Block, which reserves a range of numbers at once and hands them out
+ * without touching the shared counter. Numbers that were assigned
+ * elsewhere, e.g. read from a file, raise the high-water mark with
+ * restore(), the next number never moves backwards, so no number is
+ * handed out twice.
+ */
+class MatrikelAllocator
+{
+private:
+	/*!
+	 * @var m_next - The next number not handed out or restored.
+	 */
+	std::atomic<unsigned int> m_next;
+
+public:
+	/*!
+	 * @class Block
+	 * @brief A range of numbers reserved by one thread.
+	 *
+	 * The range is reserved blockSize numbers at a time, when the previous
+	 * range is used up, so the size should be the number of numbers needed.
+	 * Numbers left unused stay unused, since a restored number may lie
+	 * inside the range. For the same reason a number of the range may be
+	 * taken already, the caller then takes another one with allocate().
+	 */
+	class Block
+	{
+	private:
+		/*!
+		 * @var m_allocator - The allocator the ranges are reserved from.
+		 */
+		MatrikelAllocator& m_allocator;
+
+		/*!
+		 * @var m_blockSize - Number of numbers reserved at a time.
+		 */
+		unsigned int m_blockSize;
+
+		/*!
+		 * @var m_next, m_end - The unused part of the current range.
+		 */
+		unsigned int m_next;
+		unsigned int m_end;
+
+	public:
+		/*!
+		 * @brief Constructor, the first range is reserved on first use.
+		 *
+		 * @param allocator The allocator the ranges are reserved from.
+		 * @param blockSize Number of numbers reserved at a time, at least 1.
+		 */
+		Block(MatrikelAllocator& allocator, unsigned int blockSize);
+
+		Block(const Block&) = delete;
+		Block& operator=(const Block&) = delete;
+
+		/*!
+		 * @brief Returns the next number of the range.
+		 */
+		unsigned int allocate();
+	};
+
+	/*!
+	 * @brief Constructor.
+	 *
+	 * @param first The first number to be handed out.
+	 */
+	explicit MatrikelAllocator(unsigned int first);
+
+	/*!
+	 * @brief Returns a new number.
+	 */
+	unsigned int allocate();
+
+	/*!
+	 * @brief Reserves a range of consecutive numbers.
+	 *
+	 * @param count Number of numbers to be reserved.
+	 * @return The first number of the range.
+	 */
+	unsigned int reserve(unsigned int count);
+
+	/*!
+	 * @brief Marks a number assigned elsewhere as used, the next number
+	 * is raised above it if needed.
+	 */
+	void restore(unsigned int usedNumber);
+
+	/*!
+	 * @brief Getter method for the next number to be handed out.
+	 */
+	unsigned int getNext() const;
+};
+
+#endif /* MATRIKELALLOCATOR_H_ */
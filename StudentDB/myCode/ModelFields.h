@@ -0,0 +1,123 @@
+/*!
+ * @file ModelFields.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef MODELFIELDS_H_
+#define MODELFIELDS_H_
+
+#include "FieldDescriptors.h"
+#include "Student.h"
+#include "BlockCourse.h"
+#include "WeeklyCourse.h"
+
+/*!
+ * The serialized fields of every model class, in the order of the text and
+ * binary formats. The JSON keys are the names given here. write(), read(),
+ * toJson(), fromJson(), writeBinary() and readBinary() of the model classes
+ * are all generated from these lists, so adding a field to a format means
+ * adding one line here (and the constructor parameter it is read into).
+ */
+
+/*!
+ * @brief The serialized fields of Address.
+ */
+inline auto addressFields()
+{
+	return std::make_tuple(
+			makeField<std::string>("street",
+					[](const Address& address) -> const std::string& { return address.getstreet(); }),
+			makeField<unsigned short>("postalCode",
+					[](const Address& address) { return address.getpostalCode(); }),
+			makeField<std::string>("cityName",
+					[](const Address& address) -> const std::string& { return address.getcityName(); }),
+			makeField<std::string>("additionalInfo",
+					[](const Address& address) -> const std::string& { return address.getadditionalInfo(); }));
+}
+
+/*!
+ * @brief The serialized fields of Student, the address and the
+ * enrollments are serialized as nested data.
+ */
+inline auto studentFields()
+{
+	return std::make_tuple(
+			makeField<unsigned int>("matrikelNumber",
+					[](const Student& student) { return student.getMatrikelNumber(); }),
+			makeField<std::string>("firstName",
+					[](const Student& student) -> const std::string& { return student.getFirstName(); }),
+			makeField<std::string>("lastName",
+					[](const Student& student) -> const std::string& { return student.getLastName(); }),
+			makeField<Poco::Data::Date>("dateOfBirth",
+					[](const Student& student) { return student.getDateOfBirth(); }));
+}
+
+/*!
+ * @brief The serialized fields of Enrollment.
+ */
+inline auto enrollmentFields()
+{
+	return std::make_tuple(
+			makeField<unsigned int>("courseKey",
+					[](const Enrollment& enrollment) { return enrollment.getcourse()->getcourseKey(); }),
+			makeField<std::string>("semester",
+					[](const Enrollment& enrollment) -> const std::string& { return enrollment.getsemester(); }),
+			makeField<float>("grade",
+					[](const Enrollment& enrollment) { return enrollment.getgrade(); }));
+}
+
+/*!
+ * @brief The serialized fields common to all courses.
+ */
+inline auto courseFields()
+{
+	return std::make_tuple(
+			makeField<unsigned int>("courseKey",
+					[](const Course& course) { return course.getcourseKey(); }),
+			makeField<std::string>("title",
+					[](const Course& course) { return course.gettitle(); }),
+			makeField<std::string>("major",
+					[](const Course& course) -> const std::string& { return course.getMajorName(); }),
+			makeField<float>("creditPoints",
+					[](const Course& course) { return course.getcreditPoints(); }),
+			makeField<std::string>("semester",
+					[](const Course& course) { return course.getSemester(); }));
+}
+
+/*!
+ * @brief The serialized fields of BlockCourse, in the order
+ * of the BlockCourse constructor parameters.
+ */
+inline auto blockCourseFields()
+{
+	return std::tuple_cat(courseFields(), std::make_tuple(
+			makeField<Poco::Data::Date>("startDate",
+					[](const BlockCourse& course) { return course.getStartDate(); }),
+			makeField<Poco::Data::Date>("endDate",
+					[](const BlockCourse& course) { return course.getEndDate(); }),
+			makeField<Poco::Data::Time>("startTime",
+					[](const BlockCourse& course) { return course.getStartTime(); }),
+			makeField<Poco::Data::Time>("endTime",
+					[](const BlockCourse& course) { return course.getEndTime(); })));
+}
+
+/*!
+ * @brief The serialized fields of WeeklyCourse, in the order
+ * of the WeeklyCourse constructor parameters.
+ */
+inline auto weeklyCourseFields()
+{
+	return std::tuple_cat(courseFields(), std::make_tuple(
+			makeField<Poco::DateTime::DaysOfWeek>("dayOfWeek",
+					[](const WeeklyCourse& course) { return course.getDaysOfWeek(); }),
+			makeField<Poco::Data::Time>("startTime",
+					[](const WeeklyCourse& course) { return course.getStartTime(); }),
+			makeField<Poco::Data::Time>("endTime",
+					[](const WeeklyCourse& course) { return course.getEndTime(); })));
+}
+
+#endif /* MODELFIELDS_H_ */
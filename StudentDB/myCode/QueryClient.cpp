@@ -0,0 +1,73 @@
+/*!
+ * @file QueryClient.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "QueryClient.h"
+
+#include <sstream>
+#include <stdexcept>
+
+#include <Poco/Net/SocketAddress.h>
+
+using namespace std;
+
+QueryClient::QueryClient(const std::string &host, unsigned short port) :
+		m_socket(Poco::Net::SocketAddress(host, port)), m_stream(m_socket)
+{
+	this->m_socket.setNoDelay(true);
+}
+
+QueryClient::~QueryClient()
+{
+	try
+	{
+		this->m_stream << "quit\n";
+		this->m_stream.flush();
+	}
+	catch(const exception&)
+	{
+		//! The server may be gone already.
+	}
+}
+
+QueryResponse QueryClient::request(const std::string &request)
+{
+	this->m_stream << request << '\n';
+	this->m_stream.flush();
+
+	QueryResponse response;
+
+	string statusLine;
+
+	if(!getline(this->m_stream, statusLine))
+	{
+		throw runtime_error("Connection closed by the query server");
+	}
+
+	istringstream status(statusLine);
+
+	size_t noOfLines = 0;
+
+	status >> response.code >> noOfLines;
+
+	status.ignore(1);
+
+	getline(status, response.message);
+
+	response.lines.resize(noOfLines);
+
+	for(string& line : response.lines)
+	{
+		if(!getline(this->m_stream, line))
+		{
+			throw runtime_error("Connection closed by the query server");
+		}
+	}
+
+	return response;
+}
@@ -0,0 +1,74 @@
+/*!
+ * @file QueryClient.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef QUERYCLIENT_H_
+#define QUERYCLIENT_H_
+
+#include <string>
+#include <vector>
+
+#include <Poco/Net/SocketStream.h>
+#include <Poco/Net/StreamSocket.h>
+
+/*!
+ * @struct QueryResponse
+ * @brief One response of a QueryServer.
+ */
+struct QueryResponse
+{
+	unsigned int code = 0;				///< Status code, e.g. 200 for success.
+	std::string message;				///< Message of the status line.
+	std::vector<std::string> lines;		///< The data lines.
+};
+
+/*!
+ * @class QueryClient
+ * @brief A connection to a QueryServer, see there for the requests.
+ */
+class QueryClient
+{
+private:
+	/*!
+	 * @var m_socket - The connection to the server.
+	 */
+	Poco::Net::StreamSocket m_socket;
+
+	/*!
+	 * @var m_stream - Buffered stream over m_socket.
+	 */
+	Poco::Net::SocketStream m_stream;
+
+public:
+	/*!
+	 * @brief Connects to the server.
+	 *
+	 * @param host Host name or address of the server.
+	 * @param port Port of the server.
+	 */
+	QueryClient(const std::string& host, unsigned short port);
+
+	/*!
+	 * @brief Destructor, ends the connection with "quit".
+	 */
+	~QueryClient();
+
+	QueryClient(const QueryClient&) = delete;
+	QueryClient& operator=(const QueryClient&) = delete;
+
+	/*!
+	 * @brief Sends a request and waits for its response.
+	 *
+	 * @param request The request line, without the line end.
+	 * @return The response.
+	 * @throws std::runtime_error if the connection ends before the response.
+	 */
+	QueryResponse request(const std::string& request);
+};
+
+#endif /* QUERYCLIENT_H_ */
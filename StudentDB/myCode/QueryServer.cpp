@@ -0,0 +1,345 @@
+/*!
+ * @file QueryServer.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "QueryServer.h"
+
+#include <sstream>
+#include <stdexcept>
+
+#include <Poco/Exception.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/SocketStream.h>
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+#include <Poco/Net/TCPServerParams.h>
+
+#include "BatchCommandRunner.h"
+
+using namespace std;
+
+/*!
+ * @brief Writes the status line and the data lines of a response.
+ */
+static string response(unsigned int code, const string& message,
+		const vector<string>& lines = vector<string>())
+{
+	ostringstream out;
+
+	out << code << ' ' << lines.size() << ' ' << message << '\n';
+
+	for(const string& line : lines)
+	{
+		out << line << '\n';
+	}
+
+	return out.str();
+}
+
+/*!
+ * @brief Writes the response of a change of a student.
+ */
+static string changeResponse(StudentDb::RC_StudentDb_t result)
+{
+	unsigned int code = 409;
+
+	if(result == StudentDb::RC_StudentDb_t::RC_Success)
+	{
+		code = 200;
+	}
+	else if(result == StudentDb::RC_StudentDb_t::RC_Wrong_MatrikelNumber)
+	{
+		code = 404;
+	}
+
+	return response(code, BatchCommandRunner::resultName(result));
+}
+
+/*!
+ * @brief Writes an enrollment of a student as data line
+ * "courseKey;semester;grade".
+ */
+static string enrollmentLine(const Enrollment& enrollment)
+{
+	ostringstream line;
+
+	line << enrollment.getcourse()->getcourseKey() << ';' << enrollment.getsemester()
+			<< ';' << enrollment.getgrade();
+
+	return line.str();
+}
+
+/*!
+ * @brief Writes a student as data line, in the format of Student::write().
+ */
+static string studentLine(const Student& student)
+{
+	ostringstream line;
+
+	student.write(line);
+
+	return line.str();
+}
+
+/*!
+ * @brief Serves the requests of one client connection.
+ */
+class QueryConnection : public Poco::Net::TCPServerConnection
+{
+private:
+	/*!
+	 * @var m_db - The database served.
+	 */
+	StudentDb& m_db;
+
+public:
+	QueryConnection(const Poco::Net::StreamSocket& socket, StudentDb& db) :
+		Poco::Net::TCPServerConnection(socket), m_db(db)
+	{
+	}
+
+	void run() override
+	{
+		//! Responses are small, they are not held back for more data.
+		this->socket().setNoDelay(true);
+
+		Poco::Net::SocketStream stream(this->socket());
+
+		string request;
+
+		while(getline(stream, request))
+		{
+			if(!request.empty() && request.back() == '\r')
+			{
+				request.pop_back();
+			}
+
+			if(request == "quit")
+			{
+				stream << response(221, "Bye");
+				break;
+			}
+
+			if(!request.empty())
+			{
+				stream << QueryServer::handleRequest(this->m_db, request);
+			}
+
+			//! Answers are sent once the pipelined requests received so far are done.
+			if(stream.rdbuf()->in_avail() == 0)
+			{
+				stream.flush();
+			}
+		}
+
+		stream.flush();
+	}
+};
+
+/*!
+ * @brief Creates the QueryConnection objects.
+ */
+class QueryConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+{
+private:
+	/*!
+	 * @var m_db - The database served.
+	 */
+	StudentDb& m_db;
+
+public:
+	QueryConnectionFactory(StudentDb& db) : m_db(db)
+	{
+	}
+
+	Poco::Net::TCPServerConnection* createConnection(
+			const Poco::Net::StreamSocket& socket) override
+	{
+		return new QueryConnection(socket, this->m_db);
+	}
+};
+
+QueryServer::QueryServer(StudentDb &db, const std::string &host,
+		unsigned short port, unsigned int maxThreads)
+{
+	Poco::Net::ServerSocket serverSocket(Poco::Net::SocketAddress(host, port));
+
+	this->m_port = serverSocket.address().port();
+
+	Poco::Net::TCPServerParams::Ptr params = new Poco::Net::TCPServerParams;
+
+	params->setMaxThreads(maxThreads);
+	params->setMaxQueued(maxThreads * 4);
+
+	this->m_server.reset(new Poco::Net::TCPServer(
+			new QueryConnectionFactory(db), serverSocket, params));
+
+	this->m_server->start();
+}
+
+QueryServer::~QueryServer()
+{
+	this->m_server->stop();
+}
+
+unsigned short QueryServer::getPort() const
+{
+	return this->m_port;
+}
+
+std::string QueryServer::handleRequest(StudentDb &db, const std::string &request)
+{
+	vector<string> fields = BatchCommandRunner::splitFields(request);
+
+	const string& name = fields[0];
+
+	try
+	{
+		if(name == "get" && fields.size() == 2)
+		{
+			vector<string> lines;
+
+			bool found = db.readStudent(stoul(fields[1]), [&lines](const Student& student)
+			{
+				lines.push_back(studentLine(student));
+
+				for(const Enrollment& enrollment : student.getEnrollments())
+				{
+					lines.push_back(enrollmentLine(enrollment));
+				}
+			});
+
+			return found ? response(200, "OK", lines)
+					: response(404, "RC_Wrong_MatrikelNumber");
+		}
+		else if(name == "find" && fields.size() == 2 && !fields[1].empty())
+		{
+			vector<string> lines;
+
+			ShardedStudentMap::ReadView students = db.getStudents();
+
+			for(const pair<const int, Student>& student : students)
+			{
+				if(student.second.getFirstName().find(fields[1]) != string::npos
+						|| student.second.getLastName().find(fields[1]) != string::npos)
+				{
+					if(lines.size() == maxSearchResults)
+					{
+						return response(200, "Truncated", lines);
+					}
+
+					lines.push_back(studentLine(student.second));
+				}
+			}
+
+			return response(200, "OK", lines);
+		}
+		else if(name == "roster" && fields.size() == 2)
+		{
+			int courseKey = stoi(fields[1]);
+
+			{
+				//! Released before the snapshot, which locks the courses again.
+				StudentDb::CoursesView courses = db.getCourses();
+
+				if(courses.find(courseKey) == courses.end())
+				{
+					return response(404, "RC_Wrong_Course_Key");
+				}
+			}
+
+			vector<string> lines;
+
+			ShardedStudentMap::ReadView students = db.getStudents();
+
+			for(const pair<const int, Student>& student : students)
+			{
+				for(const Enrollment& enrollment : student.second.getEnrollments())
+				{
+					if(static_cast<int>(enrollment.getcourse()->getcourseKey()) == courseKey)
+					{
+						ostringstream line;
+
+						line << student.first << ';' << student.second.getFirstName()
+								<< ';' << student.second.getLastName() << ';'
+								<< enrollment.getsemester() << ';' << enrollment.getgrade();
+
+						lines.push_back(line.str());
+					}
+				}
+			}
+
+			return response(200, "OK", lines);
+		}
+		else if(name == "stats" && fields.size() == 2)
+		{
+			int courseKey = stoi(fields[1]);
+
+			CourseStatistics statistics;
+
+			try
+			{
+				statistics = db.getCourseStatistics(courseKey);
+			}
+			catch(const out_of_range&)
+			{
+				return response(404, "RC_Wrong_Course_Key");
+			}
+
+			vector<string> lines;
+
+			ostringstream summary;
+
+			summary << statistics.getNoOfEnrollments() << ';' << statistics.getNoOfGraded()
+					<< ';' << statistics.getMeanGrade() << ';' << statistics.getGradeVariance();
+
+			lines.push_back(summary.str());
+
+			for(unsigned int bucketIdx = 0; bucketIdx < CourseStatistics::noOfBuckets; bucketIdx++)
+			{
+				ostringstream line;
+
+				line << CourseStatistics::bucketLowerBound(bucketIdx) << ';'
+						<< statistics.getBucket(bucketIdx);
+
+				lines.push_back(line.str());
+			}
+
+			return response(200, "OK", lines);
+		}
+		else if(name == "enroll" && fields.size() == 4)
+		{
+			return changeResponse(db.addEnrollment(fields[1], fields[3], fields[2]));
+		}
+		else if(name == "grade" && fields.size() == 4)
+		{
+			return changeResponse(db.updateGrade(stoul(fields[2]), stof(fields[3]),
+					stoul(fields[1])));
+		}
+		else if(name == "unenroll" && fields.size() == 3)
+		{
+			return changeResponse(db.deleteEnrollment(stoul(fields[2]), stoul(fields[1])));
+		}
+	}
+	catch(const logic_error& error)
+	{
+		//! stoul() and stof() throw invalid_argument or out_of_range.
+		return response(400, string("Invalid field: ") + error.what());
+	}
+	catch(const Poco::Exception& error)
+	{
+		return response(400, "Invalid request: " + error.displayText());
+	}
+	catch(const exception& error)
+	{
+		//! An error in one request must not end the connection.
+		return response(400, string("Invalid request: ") + error.what());
+	}
+
+	return response(400, "Unknown request or wrong number of fields");
+}
@@ -0,0 +1,108 @@
+/*!
+ * @file QueryServer.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef QUERYSERVER_H_
+#define QUERYSERVER_H_
+
+#include <memory>
+#include <string>
+
+#include <Poco/Net/TCPServer.h>
+
+#include "StudentDb.h"
+
+/*!
+ * @class QueryServer
+ * @brief Serves lookups and enrollment changes of a StudentDb over TCP.
+ *
+ * Every request is one line, its fields separated by ';' like in the
+ * batch command file, see BatchCommandRunner:
+ *
+ * 		get;matrikelNumber
+ * 		find;name
+ * 		roster;courseKey
+ * 		stats;courseKey
+ * 		enroll;matrikelNumber;courseKey;semester
+ * 		grade;matrikelNumber;courseKey;grade
+ * 		unenroll;matrikelNumber;courseKey
+ * 		quit
+ *
+ * Every response starts with the line "code noOfLines message", followed
+ * by noOfLines data lines. The codes are 200 for success, 400 for a
+ * malformed request, 404 if the student or course does not exist and
+ * 409 if a change was refused, the message is then the result code of
+ * StudentDb, e.g. RC_Enrollment_Exists.
+ *
+ * The connections are served by the worker threads of a Poco TCPServer,
+ * one connection per thread at a time. Lookups and changes of a single
+ * student only lock its shard, searches and rosters read a snapshot of
+ * all students, so no request waits for a long one. Requests may be
+ * pipelined, the responses are sent once all received requests are done.
+ *
+ * The response to stats holds the line "noOfEnrollments;noOfGraded;mean;
+ * variance" and one line "bucketLowerBound;noOfGrades" per bucket of
+ * CourseStatistics, read without visiting the students.
+ */
+class QueryServer
+{
+private:
+	/*!
+	 * @var m_server - Accepts the connections and serves them on its threads.
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> m_server;
+
+	/*!
+	 * @var m_port - The port the server listens on.
+	 */
+	unsigned short m_port;
+
+public:
+	/*!
+	 * @brief Maximum number of students returned by a name search.
+	 */
+	static const unsigned int maxSearchResults = 100;
+
+	/*!
+	 * @brief Creates the server and starts listening.
+	 *
+	 * @param db The database served, it must outlive the server.
+	 * @param host The address to listen on, "0.0.0.0" for all interfaces.
+	 * Requests are not authenticated, so "127.0.0.1" unless the
+	 * network is trusted.
+	 * @param port The port to listen on, 0 picks a free port.
+	 * @param maxThreads Maximum number of connections served in parallel,
+	 * further connections wait in the queue of the server.
+	 */
+	QueryServer(StudentDb& db, const std::string& host, unsigned short port,
+			unsigned int maxThreads = 64);
+
+	/*!
+	 * @brief Stops the server.
+	 */
+	~QueryServer();
+
+	/*!
+	 * @brief Getter method to obtain the port the server listens on.
+	 *
+	 * @return The port.
+	 */
+	unsigned short getPort() const;
+
+	/*!
+	 * @brief Executes one request against db.
+	 *
+	 * @param db The database.
+	 * @param request The request line, without the line end.
+	 * @return The response, including the line ends, status 400 if the
+	 * request is malformed or fails with an exception.
+	 */
+	static std::string handleRequest(StudentDb& db, const std::string& request);
+};
+
+#endif /* QUERYSERVER_H_ */
@@ -0,0 +1,518 @@
+/*!
+ * @file ServerRecordScanner.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "ServerRecordScanner.h"
+
+#include <cstdlib>
+#include <climits>
+
+#include <Poco/DateTime.h>
+#include <Poco/UTF8String.h>
+
+using namespace std;
+
+/*!
+ * @brief Deepest nesting of skipped values before a line counts as malformed.
+ */
+static const unsigned int maxNestingDepth = 64;
+
+/*!
+ * @brief Returns true for the characters accepted in the student data,
+ * the same as ::isprint in the "C" locale.
+ */
+static inline bool isPrintableAscii(unsigned int ch)
+{
+	return (ch >= 0x20) && (ch <= 0x7e);
+}
+
+ServerRecordScanner::ServerRecordScanner(const std::string &line) :
+	m_pos(line.data()), m_end(line.data() + line.size())
+{
+}
+
+void ServerRecordScanner::skipWhitespace()
+{
+	while(this->m_pos < this->m_end && (*this->m_pos == ' ' || *this->m_pos == '\t'
+			|| *this->m_pos == '\n' || *this->m_pos == '\r'))
+	{
+		this->m_pos++;
+	}
+}
+
+bool ServerRecordScanner::consume(char expected)
+{
+	this->skipWhitespace();
+
+	if(this->m_pos < this->m_end && *this->m_pos == expected)
+	{
+		this->m_pos++;
+
+		return true;
+	}
+
+	return false;
+}
+
+bool ServerRecordScanner::readKey()
+{
+	return (this->readString(&this->m_key, false) == ScanResult_t::SR_Valid)
+			&& this->consume(':');
+}
+
+ServerRecordScanner::ScanResult_t
+ServerRecordScanner::readString(std::string *target, bool printableOnly)
+{
+	if(!this->consume('"'))
+	{
+		return ScanResult_t::SR_Malformed;
+	}
+
+	if(target != nullptr)
+	{
+		target->clear();
+	}
+
+	while(this->m_pos < this->m_end)
+	{
+		unsigned char ch = static_cast<unsigned char>(*this->m_pos++);
+
+		if(ch == '"')
+		{
+			return ScanResult_t::SR_Valid;
+		}
+
+		if(ch < 0x20)
+		{
+			//! JSON does not allow raw control characters in strings.
+			return ScanResult_t::SR_Malformed;
+		}
+
+		if(ch == '\\')
+		{
+			if(this->m_pos == this->m_end)
+			{
+				return ScanResult_t::SR_Malformed;
+			}
+
+			char escaped = *this->m_pos++;
+
+			switch(escaped)
+			{
+			case '"': case '\\': case '/': ch = escaped; break;
+			case 'b': ch = '\b'; break;
+			case 'f': ch = '\f'; break;
+			case 'n': ch = '\n'; break;
+			case 'r': ch = '\r'; break;
+			case 't': ch = '\t'; break;
+			case 'u':
+			{
+				if(this->m_end - this->m_pos < 4)
+				{
+					return ScanResult_t::SR_Malformed;
+				}
+
+				unsigned int codePoint = 0;
+
+				for(unsigned int digitIdx = 0; digitIdx < 4; digitIdx++)
+				{
+					char digit = *this->m_pos++;
+
+					codePoint <<= 4;
+
+					if(digit >= '0' && digit <= '9')
+					{
+						codePoint |= digit - '0';
+					}
+					else if(digit >= 'a' && digit <= 'f')
+					{
+						codePoint |= digit - 'a' + 10;
+					}
+					else if(digit >= 'A' && digit <= 'F')
+					{
+						codePoint |= digit - 'A' + 10;
+					}
+					else
+					{
+						return ScanResult_t::SR_Malformed;
+					}
+				}
+
+				//! Names are only compared, a placeholder does for other characters.
+				ch = isPrintableAscii(codePoint) ? static_cast<unsigned char>(codePoint) : 0x7f;
+			}
+			break;
+			default:
+				return ScanResult_t::SR_Malformed;
+			}
+		}
+
+		if(printableOnly && !isPrintableAscii(ch))
+		{
+			return ScanResult_t::SR_Rejected;
+		}
+
+		if(target != nullptr)
+		{
+			target->push_back(static_cast<char>(ch));
+		}
+	}
+
+	return ScanResult_t::SR_Malformed;
+}
+
+bool ServerRecordScanner::skipNumber()
+{
+	const char* start = this->m_pos;
+
+	auto skipDigits = [this]()
+	{
+		const char* first = this->m_pos;
+
+		while(this->m_pos < this->m_end && *this->m_pos >= '0' && *this->m_pos <= '9')
+		{
+			this->m_pos++;
+		}
+
+		return this->m_pos > first;
+	};
+
+	if(this->m_pos < this->m_end && *this->m_pos == '-')
+	{
+		this->m_pos++;
+	}
+
+	bool isNumber = skipDigits();
+
+	if(isNumber && this->m_pos < this->m_end && *this->m_pos == '.')
+	{
+		this->m_pos++;
+		isNumber = skipDigits();
+	}
+
+	if(isNumber && this->m_pos < this->m_end && (*this->m_pos == 'e' || *this->m_pos == 'E'))
+	{
+		this->m_pos++;
+
+		if(this->m_pos < this->m_end && (*this->m_pos == '+' || *this->m_pos == '-'))
+		{
+			this->m_pos++;
+		}
+
+		isNumber = skipDigits();
+	}
+
+	if(!isNumber)
+	{
+		this->m_pos = start;
+	}
+
+	return isNumber;
+}
+
+ServerRecordScanner::ScanResult_t ServerRecordScanner::readInteger(int &target)
+{
+	this->skipWhitespace();
+
+	if(this->m_pos < this->m_end && *this->m_pos == '"')
+	{
+		string digits;
+
+		ScanResult_t result = this->readString(&digits, true);
+
+		if(result != ScanResult_t::SR_Valid)
+		{
+			return result;
+		}
+
+		char* parsedEnd = nullptr;
+
+		long value = digits.empty() ? 0 : strtol(digits.c_str(), &parsedEnd, 10);
+
+		if(digits.empty() || *parsedEnd != '\0' || value < INT_MIN || value > INT_MAX)
+		{
+			return ScanResult_t::SR_Rejected;
+		}
+
+		target = static_cast<int>(value);
+
+		return ScanResult_t::SR_Valid;
+	}
+
+	const char* start = this->m_pos;
+
+	if(!this->skipNumber())
+	{
+		return ScanResult_t::SR_Rejected;
+	}
+
+	//! The number is followed by a delimiter, strtod stops right there.
+	double value = strtod(start, nullptr);
+
+	if(value <= INT_MIN - 1.0 || value >= INT_MAX + 1.0)
+	{
+		return ScanResult_t::SR_Rejected;
+	}
+
+	target = static_cast<int>(value);
+
+	return ScanResult_t::SR_Valid;
+}
+
+bool ServerRecordScanner::skipValue(unsigned int depth)
+{
+	this->skipWhitespace();
+
+	if(this->m_pos == this->m_end || depth > maxNestingDepth)
+	{
+		return false;
+	}
+
+	switch(*this->m_pos)
+	{
+	case '"':
+		return this->readString(nullptr, false) == ScanResult_t::SR_Valid;
+	case '{':
+		this->m_pos++;
+
+		if(this->consume('}'))
+		{
+			return true;
+		}
+
+		do
+		{
+			if(!this->readKey() || !this->skipValue(depth + 1))
+			{
+				return false;
+			}
+		} while(this->consume(','));
+
+		return this->consume('}');
+	case '[':
+		this->m_pos++;
+
+		if(this->consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			if(!this->skipValue(depth + 1))
+			{
+				return false;
+			}
+		} while(this->consume(','));
+
+		return this->consume(']');
+	default:
+		for(const char* literal : {"true", "false", "null"})
+		{
+			size_t length = char_traits<char>::length(literal);
+
+			if(static_cast<size_t>(this->m_end - this->m_pos) >= length
+					&& equal(literal, literal + length, this->m_pos))
+			{
+				this->m_pos += length;
+
+				return true;
+			}
+		}
+
+		return this->skipNumber();
+	}
+}
+
+ServerRecordScanner::ScanResult_t
+ServerRecordScanner::scan(const std::string &line, StudentRecord &record)
+{
+	enum ServerField
+	{
+		FirstName, LastName, Year, Month, Day, Street, PostCode, City, State,
+		NoOfServerFields
+	};
+
+	ServerRecordScanner scanner(line);
+
+	int year = 0, month = 0, day = 0, postalCode = 0;
+
+	unsigned int fieldsRead = 0;
+
+	//! Reads a string field, it is validated and unescaped exactly once.
+	auto readServerString = [&scanner](std::string& target)
+	{
+		ScanResult_t result = scanner.readString(&target, true);
+
+		if(result == ScanResult_t::SR_Valid && target.find('\\') != string::npos)
+		{
+			target = Poco::UTF8::unescape(target);
+		}
+
+		return result;
+	};
+
+	if(!scanner.consume('{'))
+	{
+		return ScanResult_t::SR_Malformed;
+	}
+
+	if(!scanner.consume('}'))
+	{
+		do
+		{
+			if(!scanner.readKey())
+			{
+				return ScanResult_t::SR_Malformed;
+			}
+
+			bool isName = (scanner.m_key == "name");
+			bool isDateOfBirth = !isName && (scanner.m_key == "dateOfBirth");
+			bool isLocation = !isName && !isDateOfBirth && (scanner.m_key == "location");
+
+			if(!isName && !isDateOfBirth && !isLocation)
+			{
+				if(!scanner.skipValue(1))
+				{
+					return ScanResult_t::SR_Malformed;
+				}
+
+				continue;
+			}
+
+			if(!scanner.consume('{'))
+			{
+				//! The groups of the student data have to be objects.
+				return ScanResult_t::SR_Rejected;
+			}
+
+			if(scanner.consume('}'))
+			{
+				continue;
+			}
+
+			do
+			{
+				if(!scanner.readKey())
+				{
+					return ScanResult_t::SR_Malformed;
+				}
+
+				const string& key = scanner.m_key;
+
+				int field = NoOfServerFields;
+
+				ScanResult_t result = ScanResult_t::SR_Valid;
+
+				if(isName)
+				{
+					if(key == "firstName")
+					{
+						field = FirstName;
+						result = readServerString(record.firstName);
+					}
+					else if(key == "lastName")
+					{
+						field = LastName;
+						result = readServerString(record.lastName);
+					}
+				}
+				else if(isDateOfBirth)
+				{
+					if(key == "year")
+					{
+						field = Year;
+						result = scanner.readInteger(year);
+					}
+					else if(key == "month")
+					{
+						field = Month;
+						result = scanner.readInteger(month);
+					}
+					else if(key == "date")
+					{
+						field = Day;
+						result = scanner.readInteger(day);
+					}
+				}
+				else
+				{
+					if(key == "street")
+					{
+						field = Street;
+						result = readServerString(record.street);
+					}
+					else if(key == "postCode")
+					{
+						field = PostCode;
+						result = scanner.readInteger(postalCode);
+					}
+					else if(key == "city")
+					{
+						field = City;
+						result = readServerString(record.cityName);
+					}
+					else if(key == "state")
+					{
+						field = State;
+						result = readServerString(record.additionalInfo);
+					}
+				}
+
+				if(field == NoOfServerFields)
+				{
+					if(!scanner.skipValue(2))
+					{
+						return ScanResult_t::SR_Malformed;
+					}
+				}
+				else if(result != ScanResult_t::SR_Valid)
+				{
+					return result;
+				}
+				else
+				{
+					fieldsRead |= 1u << field;
+				}
+			} while(scanner.consume(','));
+
+			if(!scanner.consume('}'))
+			{
+				return ScanResult_t::SR_Malformed;
+			}
+		} while(scanner.consume(','));
+
+		if(!scanner.consume('}'))
+		{
+			return ScanResult_t::SR_Malformed;
+		}
+	}
+
+	scanner.skipWhitespace();
+
+	if(scanner.m_pos != scanner.m_end)
+	{
+		return ScanResult_t::SR_Malformed;
+	}
+
+	if(fieldsRead != (1u << NoOfServerFields) - 1)
+	{
+		return ScanResult_t::SR_Rejected;
+	}
+
+	//! Poco::Data::Date throws for a day that does not exist, e.g. 31.02.
+	if(!Poco::DateTime::isValid(year+1900, month+1, day))
+	{
+		return ScanResult_t::SR_Rejected;
+	}
+
+	record.dateOfBirth = Poco::Data::Date(year+1900, month+1, day);
+	record.postalCode = postalCode;
+
+	return ScanResult_t::SR_Valid;
+}
@@ -0,0 +1,132 @@
+/*!
+ * @file ServerRecordScanner.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef SERVERRECORDSCANNER_H_
+#define SERVERRECORDSCANNER_H_
+
+#include "ImportRecords.h"
+
+/*!
+ * @class ServerRecordScanner
+ * @brief Extracts the student data of a generator server response
+ * straight from the JSON text.
+ *
+ * The line is scanned once, without building a Poco::JSON::Object. The
+ * string fields of "name" and "location" are validated and unescaped
+ * while they are read, the numeric fields are converted while they are
+ * read. Other members are only checked for well-formed JSON. The first
+ * field that fails validation ends the scan, the rest of the line is not
+ * looked at.
+ *
+ * A record is accepted exactly when StudentDb::extractServerRecord()
+ * accepts the parsed line: the decoded strings must consist of printable
+ * ASCII characters, all nine fields must be present and the date of
+ * birth must exist.
+ */
+class ServerRecordScanner
+{
+public:
+	/**
+	 * @brief Enum class representing the outcome of a scan.
+	 */
+	enum class ScanResult_t
+	{
+		SR_Valid,     ///< All fields were present and valid.
+		SR_Rejected,  ///< A field was missing or failed validation.
+		SR_Malformed  ///< The line is not a well-formed JSON object.
+	};
+
+private:
+	/*!
+	 * @var m_pos - The next character to be scanned.
+	 */
+	const char* m_pos;
+
+	/*!
+	 * @var m_end - The end of the line.
+	 */
+	const char* m_end;
+
+	/*!
+	 * @var m_key - The member name read last, reused for every member.
+	 */
+	std::string m_key;
+
+	/*!
+	 * @brief Constructor of a scanner positioned at the start of line.
+	 */
+	explicit ServerRecordScanner(const std::string& line);
+
+	/*!
+	 * @brief Skips the JSON whitespace in front of the next token.
+	 */
+	void skipWhitespace();
+
+	/*!
+	 * @brief Consumes the next token if it is the expected character.
+	 *
+	 * @return True if the character was consumed.
+	 */
+	bool consume(char expected);
+
+	/*!
+	 * @brief Reads a member name and the following colon into m_key.
+	 *
+	 * @return False if the JSON is malformed.
+	 */
+	bool readKey();
+
+	/*!
+	 * @brief Reads a string value.
+	 *
+	 * @param target Receives the decoded string, or nullptr to skip the value.
+	 * @param printableOnly True to reject characters that are not printable ASCII.
+	 * @return SR_Rejected as soon as a character fails validation.
+	 */
+	ScanResult_t readString(std::string* target, bool printableOnly);
+
+	/*!
+	 * @brief Skips a JSON number.
+	 *
+	 * @return False if there is no number at the position.
+	 */
+	bool skipNumber();
+
+	/*!
+	 * @brief Reads a numeric value, given as number or as string of digits.
+	 *
+	 * Fractions are truncated like Poco::Dynamic::Var::convert() does.
+	 *
+	 * @param target Receives the value.
+	 * @return SR_Rejected if the value is no number or out of range.
+	 */
+	ScanResult_t readInteger(int& target);
+
+	/*!
+	 * @brief Skips a value of any type.
+	 *
+	 * @param depth Nesting depth of the value.
+	 * @return False if the JSON is malformed or nested too deep.
+	 */
+	bool skipValue(unsigned int depth);
+
+public:
+	/*!
+	 * @brief Extracts the student data of one generator server response.
+	 *
+	 * The matrikel number of the record is not set.
+	 *
+	 * @param line The JSON line of the response.
+	 * @param record The record that receives the student data.
+	 * @return SR_Valid if the record was filled.
+	 */
+	static ScanResult_t scan(const std::string& line, StudentRecord& record);
+};
+
+#endif /* SERVERRECORDSCANNER_H_ */
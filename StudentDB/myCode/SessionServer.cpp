@@ -0,0 +1,111 @@
+/*!
+ * @file SessionServer.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "SessionServer.h"
+
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/SocketStream.h>
+#include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Net/TCPServerConnectionFactory.h>
+#include <Poco/Net/TCPServerParams.h>
+
+#include "SimpleUI.h"
+
+using namespace std;
+
+/*!
+ * @brief Runs the SimpleUI session of one connection.
+ */
+class SessionConnection : public Poco::Net::TCPServerConnection
+{
+private:
+	/*!
+	 * @var m_db - The database of all sessions.
+	 */
+	StudentDb& m_db;
+
+public:
+	SessionConnection(const Poco::Net::StreamSocket& socket, StudentDb& db) :
+		Poco::Net::TCPServerConnection(socket), m_db(db)
+	{
+	}
+
+	void run() override
+	{
+		//! Prompts are short, they are not held back for more data.
+		this->socket().setNoDelay(true);
+
+		Poco::Net::SocketStream stream(this->socket());
+
+		try
+		{
+			SimpleUI session(this->m_db, stream, stream);
+
+			session.run();
+
+			stream << "Session closed." << endl;
+		}
+		catch(const exception& error)
+		{
+			//! Ends this session only, the others go on.
+			cerr << "Session ended with an error: " << error.what() << endl;
+		}
+	}
+};
+
+/*!
+ * @brief Creates the SessionConnection objects.
+ */
+class SessionConnectionFactory : public Poco::Net::TCPServerConnectionFactory
+{
+private:
+	/*!
+	 * @var m_db - The database of all sessions.
+	 */
+	StudentDb& m_db;
+
+public:
+	SessionConnectionFactory(StudentDb& db) : m_db(db)
+	{
+	}
+
+	Poco::Net::TCPServerConnection* createConnection(
+			const Poco::Net::StreamSocket& socket) override
+	{
+		return new SessionConnection(socket, this->m_db);
+	}
+};
+
+SessionServer::SessionServer(StudentDb &db, const std::string &host,
+		unsigned short port, unsigned int maxSessions)
+{
+	Poco::Net::ServerSocket serverSocket(Poco::Net::SocketAddress(host, port));
+
+	this->m_port = serverSocket.address().port();
+
+	Poco::Net::TCPServerParams::Ptr params = new Poco::Net::TCPServerParams;
+
+	params->setMaxThreads(maxSessions);
+	params->setMaxQueued(maxSessions * 4);
+
+	this->m_server.reset(new Poco::Net::TCPServer(
+			new SessionConnectionFactory(db), serverSocket, params));
+
+	this->m_server->start();
+}
+
+SessionServer::~SessionServer()
+{
+	this->m_server->stop();
+}
+
+unsigned short SessionServer::getPort() const
+{
+	return this->m_port;
+}
@@ -0,0 +1,76 @@
+/*!
+ * @file SessionServer.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef SESSIONSERVER_H_
+#define SESSIONSERVER_H_
+
+#include <memory>
+#include <string>
+
+#include <Poco/Net/TCPServer.h>
+
+#include "StudentDb.h"
+
+/*!
+ * @class SessionServer
+ * @brief Runs one SimpleUI session per TCP connection, all against the
+ * same StudentDb.
+ *
+ * A user connects with a line based client, e.g. telnet or nc, and gets
+ * the main menu of SimpleUI, which reads and writes the connection
+ * instead of the console. The sessions are served by the worker threads
+ * of a Poco TCPServer, at most maxSessions at a time, further users wait
+ * until a session ends. StudentDb synchronizes the sessions, every
+ * session sees the changes of the others.
+ *
+ * Files written or read in a session are those of the server, the
+ * progress of a server fetch is printed on the console of the server.
+ * There is no authentication, a session may read and write any file
+ * the server may, so the server should only listen on the loopback
+ * interface or behind a tunnel.
+ */
+class SessionServer
+{
+private:
+	/*!
+	 * @var m_server - Accepts the connections and serves them on its threads.
+	 */
+	std::unique_ptr<Poco::Net::TCPServer> m_server;
+
+	/*!
+	 * @var m_port - The port the server listens on.
+	 */
+	unsigned short m_port;
+
+public:
+	/*!
+	 * @brief Creates the server and starts listening.
+	 *
+	 * @param db The database of all sessions, it must outlive the server.
+	 * @param host The address to listen on, "0.0.0.0" for all interfaces.
+	 * @param port The port to listen on, 0 picks a free port.
+	 * @param maxSessions Maximum number of sessions served in parallel.
+	 */
+	SessionServer(StudentDb& db, const std::string& host, unsigned short port,
+			unsigned int maxSessions = 16);
+
+	/*!
+	 * @brief Stops the server, running sessions end with their connection.
+	 */
+	~SessionServer();
+
+	/*!
+	 * @brief Getter method to obtain the port the server listens on.
+	 *
+	 * @return The port.
+	 */
+	unsigned short getPort() const;
+};
+
+#endif /* SESSIONSERVER_H_ */
@@ -0,0 +1,448 @@
+/*!
+ * @file ShardedStudentMap.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "ShardedStudentMap.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+ShardedStudentMap::StudentVersion::StudentVersion(int matrikelNumber, const Student &student) :
+		entry(matrikelNumber, student), version(0), older(nullptr)
+{
+}
+
+ShardedStudentMap::StudentSlot::StudentSlot() : matrikelNumber(0), head(nullptr)
+{
+}
+
+ShardedStudentMap::StudentSlot::~StudentSlot()
+{
+	StudentVersion* version = this->head.load();
+
+	while(version != nullptr)
+	{
+		StudentVersion* older = version->older.load();
+
+		delete version;
+
+		version = older;
+	}
+}
+
+ShardedStudentMap::SlotArray::SlotArray() : size(0)
+{
+	for(atomic<StudentSlot*>& segment : this->segments)
+	{
+		segment = nullptr;
+	}
+}
+
+ShardedStudentMap::SlotArray::~SlotArray()
+{
+	for(atomic<StudentSlot*>& segment : this->segments)
+	{
+		delete[] segment.load();
+	}
+}
+
+ShardedStudentMap::StudentSlot& ShardedStudentMap::SlotArray::at(std::size_t slotIdx) const
+{
+	return this->segments[slotIdx / slotsPerSegment].load()[slotIdx % slotsPerSegment];
+}
+
+ShardedStudentMap::StudentSlot& ShardedStudentMap::SlotArray::append(int matrikelNumber)
+{
+	size_t slotIdx = this->size.load();
+
+	size_t segmentIdx = slotIdx / slotsPerSegment;
+
+	if(segmentIdx >= maxSegments)
+	{
+		throw length_error("Too many students in one shard");
+	}
+
+	if(this->segments[segmentIdx].load() == nullptr)
+	{
+		this->segments[segmentIdx].store(new StudentSlot[slotsPerSegment]);
+	}
+
+	StudentSlot& slot = this->at(slotIdx);
+
+	slot.matrikelNumber = matrikelNumber;
+
+	//! Published after the slot is filled, readers skip it until its first version.
+	this->size.store(slotIdx + 1);
+
+	return slot;
+}
+
+ShardedStudentMap::ReadView::ReadView(const ShardedStudentMap &map,
+		std::shared_lock<std::shared_timed_mutex> outerLock) :
+		m_outerLock(move(outerLock)), m_map(&map), m_version(0)
+{
+	this->m_pinSlot = map.m_snapshots.pin(map.m_committed, this->m_version);
+
+	const Generation& generation = *map.m_generation.load();
+
+	this->m_students.reserve(map.size());
+
+	for(const SlotArray& slots : generation.shards)
+	{
+		size_t noOfSlots = slots.size.load();
+
+		for(size_t slotIdx = 0; slotIdx < noOfSlots; slotIdx++)
+		{
+			//! The newest version that is not newer than the snapshot.
+			const StudentVersion* version = slots.at(slotIdx).head.load();
+
+			while(version != nullptr && version->version > this->m_version)
+			{
+				version = version->older.load();
+			}
+
+			if(version != nullptr)
+			{
+				this->m_students.push_back(&version->entry);
+			}
+		}
+	}
+
+	sort(this->m_students.begin(), this->m_students.end(),
+			[](const value_type* lhs, const value_type* rhs){ return lhs->first < rhs->first; });
+}
+
+ShardedStudentMap::ReadView::ReadView(ReadView &&other) :
+		m_outerLock(move(other.m_outerLock)), m_map(other.m_map),
+		m_pinSlot(other.m_pinSlot), m_version(other.m_version),
+		m_students(move(other.m_students))
+{
+	other.m_map = nullptr;
+}
+
+ShardedStudentMap::ReadView::~ReadView()
+{
+	if(this->m_map != nullptr)
+	{
+		this->m_map->m_snapshots.unpin(this->m_pinSlot);
+	}
+}
+
+ShardedStudentMap::ReadView::const_iterator ShardedStudentMap::ReadView::begin() const
+{
+	return const_iterator(this->m_students.begin());
+}
+
+ShardedStudentMap::ReadView::const_iterator ShardedStudentMap::ReadView::end() const
+{
+	return const_iterator(this->m_students.end());
+}
+
+std::size_t ShardedStudentMap::ReadView::size() const
+{
+	return this->m_students.size();
+}
+
+bool ShardedStudentMap::ReadView::empty() const
+{
+	return this->m_students.empty();
+}
+
+ShardedStudentMap::ReadView::const_iterator
+ShardedStudentMap::ReadView::find(int matrikelNumber) const
+{
+	vector<const value_type*>::const_iterator itr = lower_bound(this->m_students.begin(),
+			this->m_students.end(), matrikelNumber,
+			[](const value_type* student, int key){ return student->first < key; });
+
+	if(itr != this->m_students.end() && (*itr)->first == matrikelNumber)
+	{
+		return const_iterator(itr);
+	}
+
+	return this->end();
+}
+
+std::uint64_t ShardedStudentMap::ReadView::getVersion() const
+{
+	return this->m_version;
+}
+
+ShardedStudentMap::ShardedStudentMap() :
+		m_generation(new Generation), m_size(0), m_committed(1)
+{
+}
+
+ShardedStudentMap::~ShardedStudentMap()
+{
+	delete this->m_generation.load();
+}
+
+unsigned int ShardedStudentMap::shardOf(int matrikelNumber)
+{
+	return static_cast<unsigned int>(matrikelNumber) % noOfShards;
+}
+
+void ShardedStudentMap::commit(StudentSlot &slot, StudentVersion *version)
+{
+	{
+		lock_guard<mutex> commitLock(this->m_commitMutex);
+
+		uint64_t versionNumber = this->m_committed.load() + 1;
+
+		version->version = versionNumber;
+		version->older.store(slot.head.load());
+
+		slot.head.store(version);
+
+		this->m_committed.store(versionNumber);
+
+		if(!this->m_retired.empty())
+		{
+			this->reclaimGenerations();
+		}
+	}
+
+	this->trimVersions(slot);
+}
+
+void ShardedStudentMap::trimVersions(StudentSlot &slot)
+{
+	uint64_t oldest = this->m_snapshots.oldestPinned(this->m_committed.load());
+
+	//! No reader goes past the newest version not newer than the oldest snapshot.
+	StudentVersion* version = slot.head.load();
+
+	while(version != nullptr && version->version > oldest)
+	{
+		version = version->older.load();
+	}
+
+	if(version == nullptr)
+	{
+		return;
+	}
+
+	StudentVersion* unreachable = version->older.exchange(nullptr);
+
+	while(unreachable != nullptr)
+	{
+		StudentVersion* older = unreachable->older.load();
+
+		delete unreachable;
+
+		unreachable = older;
+	}
+}
+
+void ShardedStudentMap::reclaimGenerations()
+{
+	uint64_t oldest = this->m_snapshots.oldestPinned(this->m_committed.load());
+
+	this->m_retired.erase(remove_if(this->m_retired.begin(), this->m_retired.end(),
+			[oldest](const pair<uint64_t, unique_ptr<Generation>>& retired)
+			{ return retired.first < oldest; }), this->m_retired.end());
+}
+
+bool ShardedStudentMap::insert(const Student &student)
+{
+	int matrikelNumber = student.getMatrikelNumber();
+
+	Shard& shard = this->m_shards[shardOf(matrikelNumber)];
+
+	unique_lock<shared_timed_mutex> lock(shard.mutex);
+
+	if(shard.index.count(matrikelNumber) > 0)
+	{
+		return false;
+	}
+
+	unique_ptr<StudentVersion> version(new StudentVersion(matrikelNumber, student));
+
+	StudentSlot& slot = this->m_generation.load()->shards[shardOf(matrikelNumber)]
+			.append(matrikelNumber);
+
+	shard.index[matrikelNumber] = &slot;
+
+	this->commit(slot, version.release());
+
+	this->m_size++;
+
+	return true;
+}
+
+bool ShardedStudentMap::contains(int matrikelNumber) const
+{
+	const Shard& shard = this->m_shards[shardOf(matrikelNumber)];
+
+	shared_lock<shared_timed_mutex> lock(shard.mutex);
+
+	return shard.index.count(matrikelNumber) > 0;
+}
+
+bool ShardedStudentMap::read(int matrikelNumber,
+		const std::function<void(const Student&)>& reader) const
+{
+	const Shard& shard = this->m_shards[shardOf(matrikelNumber)];
+
+	shared_lock<shared_timed_mutex> lock(shard.mutex);
+
+	unordered_map<int, StudentSlot*>::const_iterator findSlot = shard.index.find(matrikelNumber);
+
+	if(findSlot == shard.index.end())
+	{
+		return false;
+	}
+
+	reader(findSlot->second->head.load()->entry.second);
+
+	return true;
+}
+
+bool ShardedStudentMap::update(int matrikelNumber,
+		const std::function<void(Student&)>& writer)
+{
+	Shard& shard = this->m_shards[shardOf(matrikelNumber)];
+
+	unique_lock<shared_timed_mutex> lock(shard.mutex);
+
+	unordered_map<int, StudentSlot*>::iterator findSlot = shard.index.find(matrikelNumber);
+
+	if(findSlot == shard.index.end())
+	{
+		return false;
+	}
+
+	StudentSlot& slot = *findSlot->second;
+
+	//! The copy is not visible to readers before it is committed.
+	unique_ptr<StudentVersion> version(
+			new StudentVersion(matrikelNumber, slot.head.load()->entry.second));
+
+	writer(version->entry.second);
+
+	this->commit(slot, version.release());
+
+	return true;
+}
+
+void ShardedStudentMap::clear()
+{
+	vector<unique_lock<shared_timed_mutex>> locks;
+
+	locks.reserve(noOfShards);
+
+	for(Shard& shard : this->m_shards)
+	{
+		locks.emplace_back(shard.mutex);
+
+		shard.index.clear();
+	}
+
+	lock_guard<mutex> commitLock(this->m_commitMutex);
+
+	//! Readers that pinned up to the current version may still read the old slots.
+	uint64_t lastReader = this->m_committed.load();
+
+	this->m_retired.emplace_back(lastReader,
+			unique_ptr<Generation>(this->m_generation.exchange(new Generation)));
+
+	this->m_committed.store(lastReader + 1);
+
+	this->m_size = 0;
+
+	this->reclaimGenerations();
+}
+
+void ShardedStudentMap::replaceWith(ShardedStudentMap &other)
+{
+	//! The students of other get one version number of this map, newer than
+	//! every pinned reader, and lose their older versions no one can read.
+	Generation* generation = other.m_generation.exchange(new Generation);
+
+	for(SlotArray& slots : generation->shards)
+	{
+		size_t noOfSlots = slots.size.load();
+
+		for(size_t slotIdx = 0; slotIdx < noOfSlots; slotIdx++)
+		{
+			StudentVersion* version = slots.at(slotIdx).head.load();
+
+			if(version == nullptr)
+			{
+				continue;
+			}
+
+			StudentVersion* unreachable = version->older.exchange(nullptr);
+
+			while(unreachable != nullptr)
+			{
+				StudentVersion* older = unreachable->older.load();
+
+				delete unreachable;
+
+				unreachable = older;
+			}
+		}
+	}
+
+	vector<unique_lock<shared_timed_mutex>> locks;
+
+	locks.reserve(noOfShards);
+
+	for(unsigned int shardIdx = 0; shardIdx < noOfShards; shardIdx++)
+	{
+		locks.emplace_back(this->m_shards[shardIdx].mutex);
+
+		this->m_shards[shardIdx].index.swap(other.m_shards[shardIdx].index);
+
+		other.m_shards[shardIdx].index.clear();
+	}
+
+	lock_guard<mutex> commitLock(this->m_commitMutex);
+
+	uint64_t lastReader = this->m_committed.load();
+
+	for(SlotArray& slots : generation->shards)
+	{
+		size_t noOfSlots = slots.size.load();
+
+		for(size_t slotIdx = 0; slotIdx < noOfSlots; slotIdx++)
+		{
+			StudentVersion* version = slots.at(slotIdx).head.load();
+
+			if(version != nullptr)
+			{
+				version->version = lastReader + 1;
+			}
+		}
+	}
+
+	//! Published after the renumbering, readers pinned up to lastReader skip it.
+	this->m_retired.emplace_back(lastReader,
+			unique_ptr<Generation>(this->m_generation.exchange(generation)));
+
+	this->m_committed.store(lastReader + 1);
+
+	this->m_size = other.m_size.exchange(0);
+
+	this->reclaimGenerations();
+}
+
+std::size_t ShardedStudentMap::size() const
+{
+	return this->m_size.load();
+}
+
+ShardedStudentMap::ReadView ShardedStudentMap::view(
+		std::shared_lock<std::shared_timed_mutex> outerLock) const
+{
+	return ReadView(*this, move(outerLock));
+}
@@ -0,0 +1,415 @@
+/*!
+ * @file ShardedStudentMap.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef SHARDEDSTUDENTMAP_H_
+#define SHARDEDSTUDENTMAP_H_
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <boost/iterator/indirect_iterator.hpp>
+
+#include "Student.h"
+#include "SnapshotRegistry.h"
+
+/*!
+ * @class ShardedStudentMap
+ * @brief The students of a database, keyed by matrikel number and split
+ * into shards, with multi-version concurrency for the readers.
+ *
+ * Every student is a chain of immutable versions. A writer locks the
+ * shard of the student, selected by its matrikel number, copies the
+ * newest version, changes the copy and publishes it with the next
+ * version number. A ReadView pins the committed version number and sees
+ * the newest version of every student not newer than that, without any
+ * lock, so long reads never wait for writers and writers never wait for
+ * them. Versions no pinned reader can reach any more are freed by the
+ * writers, see SnapshotRegistry.
+ */
+class ShardedStudentMap
+{
+public:
+	/*!
+	 * @brief The elements of the map, as in std::map<int, Student>.
+	 */
+	typedef std::pair<const int, Student> value_type;
+
+	/*!
+	 * @brief Number of shards.
+	 */
+	static const unsigned int noOfShards = 16;
+
+private:
+	/*!
+	 * @brief One immutable version of a student.
+	 */
+	struct StudentVersion
+	{
+		/*!
+		 * @var entry - The matrikel number and the student.
+		 */
+		value_type entry;
+
+		/*!
+		 * @var version - The version number that committed it.
+		 */
+		std::uint64_t version;
+
+		/*!
+		 * @var older - The version it replaced, nullptr once freed.
+		 */
+		std::atomic<StudentVersion*> older;
+
+		/*!
+		 * @brief Constructor of a version not yet committed.
+		 */
+		StudentVersion(int matrikelNumber, const Student& student);
+	};
+
+	/*!
+	 * @brief The versions of one student.
+	 */
+	struct StudentSlot
+	{
+		/*!
+		 * @var matrikelNumber - Matrikel number of the student.
+		 */
+		int matrikelNumber;
+
+		/*!
+		 * @var head - The newest version, nullptr until the first is committed.
+		 */
+		std::atomic<StudentVersion*> head;
+
+		/*!
+		 * @brief Constructor of an empty slot.
+		 */
+		StudentSlot();
+
+		/*!
+		 * @brief Destructor, frees all versions.
+		 */
+		~StudentSlot();
+	};
+
+	/*!
+	 * @brief Number of slots per segment of a SlotArray.
+	 */
+	static const std::size_t slotsPerSegment = 1024;
+
+	/*!
+	 * @brief Maximum number of segments of a SlotArray.
+	 */
+	static const std::size_t maxSegments = 1024;
+
+	/*!
+	 * @brief The slots of one shard, in the order they were added.
+	 *
+	 * The slots never move, readers see the first size slots.
+	 */
+	struct SlotArray
+	{
+		/*!
+		 * @var segments - The segments of slotsPerSegment slots each.
+		 */
+		std::array<std::atomic<StudentSlot*>, maxSegments> segments;
+
+		/*!
+		 * @var size - Number of slots visible to readers.
+		 */
+		std::atomic<std::size_t> size;
+
+		/*!
+		 * @brief Constructor of an empty array.
+		 */
+		SlotArray();
+
+		/*!
+		 * @brief Destructor, frees all slots.
+		 */
+		~SlotArray();
+
+		/*!
+		 * @brief Returns the slot with the given index.
+		 */
+		StudentSlot& at(std::size_t slotIdx) const;
+
+		/*!
+		 * @brief Adds a slot, visible to readers once the call returns.
+		 *
+		 * @throws std::length_error if all segments are full.
+		 */
+		StudentSlot& append(int matrikelNumber);
+	};
+
+	/*!
+	 * @brief The slots of all shards, replaced as a whole by clear().
+	 */
+	struct Generation
+	{
+		/*!
+		 * @var shards - The slots per shard.
+		 */
+		std::array<SlotArray, noOfShards> shards;
+	};
+
+	/*!
+	 * @brief The writer side of one shard, on its own cache lines.
+	 */
+	struct alignas(64) Shard
+	{
+		/*!
+		 * @var mutex - Exclusive for writers of the shard, shared by
+		 * the lookups of a single student.
+		 */
+		mutable std::shared_timed_mutex mutex;
+
+		/*!
+		 * @var index - The slot of every matrikel number of the shard.
+		 */
+		std::unordered_map<int, StudentSlot*> index;
+	};
+
+	/*!
+	 * @var m_shards - The shards.
+	 */
+	std::array<Shard, noOfShards> m_shards;
+
+	/*!
+	 * @var m_generation - The slots of all shards.
+	 */
+	std::atomic<Generation*> m_generation;
+
+	/*!
+	 * @var m_size - Number of students in all shards.
+	 */
+	std::atomic<std::size_t> m_size;
+
+	/*!
+	 * @var m_committed - The newest committed version number.
+	 */
+	std::atomic<std::uint64_t> m_committed;
+
+	/*!
+	 * @var m_commitMutex - Orders the commits, guards m_retired.
+	 */
+	std::mutex m_commitMutex;
+
+	/*!
+	 * @var m_snapshots - The version numbers pinned by the readers.
+	 */
+	mutable SnapshotRegistry m_snapshots;
+
+	/*!
+	 * @var m_retired - Generations replaced by clear(), with the last
+	 * version number that may still read them.
+	 */
+	std::vector<std::pair<std::uint64_t, std::unique_ptr<Generation>>> m_retired;
+
+	/*!
+	 * @brief Returns the shard index of a matrikel number.
+	 */
+	static unsigned int shardOf(int matrikelNumber);
+
+	/*!
+	 * @brief Publishes a new version of a student and frees the versions
+	 * no reader can reach any more, with the shard locked exclusively.
+	 */
+	void commit(StudentSlot& slot, StudentVersion* version);
+
+	/*!
+	 * @brief Frees the versions of a slot older than the one the oldest
+	 * pinned reader sees, with the shard locked exclusively.
+	 */
+	void trimVersions(StudentSlot& slot);
+
+	/*!
+	 * @brief Frees the retired generations no reader can reach any more,
+	 * with m_commitMutex locked.
+	 */
+	void reclaimGenerations();
+
+public:
+	/*!
+	 * @class ReadView
+	 * @brief A consistent snapshot of all students, in the order of
+	 * their matrikel numbers.
+	 *
+	 * The view pins the committed version number for its lifetime and
+	 * holds no lock of the map, writers go on while it exists. Later
+	 * changes are not visible in the view.
+	 */
+	class ReadView
+	{
+	private:
+		/*!
+		 * @var m_outerLock - A lock of the owner of the map, held as long
+		 * as the view and taken before the snapshot.
+		 */
+		std::shared_lock<std::shared_timed_mutex> m_outerLock;
+
+		/*!
+		 * @var m_map - The viewed map, nullptr once moved from.
+		 */
+		const ShardedStudentMap* m_map;
+
+		/*!
+		 * @var m_pinSlot - The slot of the pinned version in the SnapshotRegistry.
+		 */
+		unsigned int m_pinSlot;
+
+		/*!
+		 * @var m_version - The pinned version number.
+		 */
+		std::uint64_t m_version;
+
+		/*!
+		 * @var m_students - The students of all shards, sorted by matrikel number.
+		 */
+		std::vector<const value_type*> m_students;
+
+	public:
+		/*!
+		 * @brief Iterator over the students, dereferences to a value_type.
+		 */
+		typedef boost::indirect_iterator<std::vector<const value_type*>::const_iterator>
+				const_iterator;
+
+		/*!
+		 * @brief Constructor, takes the snapshot of the map.
+		 *
+		 * @param map The map to be viewed.
+		 * @param outerLock A lock already taken, released with the view.
+		 */
+		ReadView(const ShardedStudentMap& map,
+				std::shared_lock<std::shared_timed_mutex> outerLock);
+
+		/*!
+		 * @brief Move constructor, the snapshot passes to the new view.
+		 */
+		ReadView(ReadView&& other);
+
+		ReadView(const ReadView&) = delete;
+		ReadView& operator=(const ReadView&) = delete;
+
+		/*!
+		 * @brief Destructor, releases the pinned version.
+		 */
+		~ReadView();
+
+		/*!
+		 * @brief Range of all students.
+		 */
+		const_iterator begin() const;
+		const_iterator end() const;
+
+		/*!
+		 * @brief Number of students in the view.
+		 */
+		std::size_t size() const;
+
+		/*!
+		 * @brief Checks if there are no students in the view.
+		 */
+		bool empty() const;
+
+		/*!
+		 * @brief Finds a student by its matrikel number.
+		 *
+		 * @return Iterator to the student, end() if there is no such student.
+		 */
+		const_iterator find(int matrikelNumber) const;
+
+		/*!
+		 * @brief Getter method for the version number of the snapshot.
+		 */
+		std::uint64_t getVersion() const;
+	};
+
+	/*!
+	 * @brief Constructor of an empty map.
+	 */
+	ShardedStudentMap();
+
+	/*!
+	 * @brief Destructor, frees all versions. No view may exist any more.
+	 */
+	~ShardedStudentMap();
+
+	ShardedStudentMap(const ShardedStudentMap&) = delete;
+	ShardedStudentMap& operator=(const ShardedStudentMap&) = delete;
+
+	/*!
+	 * @brief Inserts a student under its matrikel number.
+	 *
+	 * @param student The student to be inserted, copied into the map.
+	 * @return True if inserted, false if the matrikel number was taken.
+	 */
+	bool insert(const Student& student);
+
+	/*!
+	 * @brief Checks for a student.
+	 *
+	 * @return True if a student has the matrikel number.
+	 */
+	bool contains(int matrikelNumber) const;
+
+	/*!
+	 * @brief Calls reader with the newest version of the student.
+	 *
+	 * @return False if there is no student with the matrikel number.
+	 */
+	bool read(int matrikelNumber, const std::function<void(const Student&)>& reader) const;
+
+	/*!
+	 * @brief Calls writer with a copy of the newest version of the student,
+	 * under the exclusive lock of its shard, and commits the copy as the
+	 * next version.
+	 *
+	 * @return False if there is no student with the matrikel number.
+	 */
+	bool update(int matrikelNumber, const std::function<void(Student&)>& writer);
+
+	/*!
+	 * @brief Removes all students, with all shards locked at once.
+	 *
+	 * Views taken before keep their students.
+	 */
+	void clear();
+
+	/*!
+	 * @brief Replaces all students by the students of other, which is
+	 * left empty, with all shards locked at once.
+	 *
+	 * Views taken before keep their students, as after clear(). No other
+	 * thread may use other and no view of other may exist.
+	 *
+	 * @param other The map the students are taken from.
+	 */
+	void replaceWith(ShardedStudentMap& other);
+
+	/*!
+	 * @brief Getter method for the number of students.
+	 */
+	std::size_t size() const;
+
+	/*!
+	 * @brief Returns a snapshot of all students.
+	 *
+	 * @param outerLock A lock to be held as long as the view, if any.
+	 */
+	ReadView view(std::shared_lock<std::shared_timed_mutex> outerLock =
+			std::shared_lock<std::shared_timed_mutex>()) const;
+};
+
+#endif /* SHARDEDSTUDENTMAP_H_ */
@@ -9,9 +9,12 @@
 
 #include "SimpleUI.h"
 
+#include <sstream>
+
 using namespace std;
 
-SimpleUI::SimpleUI(StudentDb &db) : m_db(db)
+SimpleUI::SimpleUI(StudentDb &db, std::istream &in, std::ostream &out) :
+		m_db(db), m_in(in), m_out(out)
 {
 }
 
@@ -20,47 +23,67 @@ SimpleUI::~SimpleUI()
 }
 
 void SimpleUI::run() const
+{
+	try
+	{
+		this->runMenu();
+	}
+	catch(const runtime_error&)
+	{
+		//! The user input ended, e.g. the session was disconnected.
+		if(!this->m_in.eof())
+		{
+			throw;
+		}
+	}
+}
+
+void SimpleUI::runMenu() const
 {
 	bool exitFlag = false;
 
-	cout << "Main Menu: Below are the properties of Student Database : " << endl << endl;
-
-	cout << "\t 0	-> To Exit Main Menu" << endl;
-	cout << "\t 1 	-> To Add New Course" << endl;
-	cout << "\t 2 	-> To List the Courses" << endl;
-	cout << "\t 3 	-> To Add new Student" << endl;
-	cout << "\t 4 	-> To Add Enrollment" << endl;
-	cout << "\t 5 	-> To Print Student Details" << endl;
-	cout << "\t 6 	-> To Search Student in Database" << endl;
-	cout << "\t 7 	-> To Update Student Details" << endl;
-	cout << "\t 8 	-> To Write Student Database to a text file" << endl;
-	cout << "\t 9 	-> To Read Student Database from a file" << endl;
-	cout << "\t 10 	-> To Read Student Database from a server" << endl;
-	cout << "\t 11 	-> To Write Student Data in JSON Format" << endl;
-	cout << "\t 12 	-> To Read Student Data from JSON Format" << endl;
+	this->m_out << "Main Menu: Below are the properties of Student Database : " << endl << endl;
+
+	this->m_out << "\t 0	-> To Exit Main Menu" << endl;
+	this->m_out << "\t 1 	-> To Add New Course" << endl;
+	this->m_out << "\t 2 	-> To List the Courses" << endl;
+	this->m_out << "\t 3 	-> To Add new Student" << endl;
+	this->m_out << "\t 4 	-> To Add Enrollment" << endl;
+	this->m_out << "\t 5 	-> To Print Student Details" << endl;
+	this->m_out << "\t 6 	-> To Search Student in Database" << endl;
+	this->m_out << "\t 7 	-> To Update Student Details" << endl;
+	this->m_out << "\t 8 	-> To Write Student Database to a text file" << endl;
+	this->m_out << "\t 9 	-> To Read Student Database from a file" << endl;
+	this->m_out << "\t 10 	-> To Read Student Database from a server" << endl;
+	this->m_out << "\t 11 	-> To Write Student Data in JSON Format" << endl;
+	this->m_out << "\t 12 	-> To Read Student Data from JSON Format" << endl;
+	this->m_out << "\t 13 	-> To Write Student Data in JSON Lines Format" << endl;
+	this->m_out << "\t 14 	-> To Read Student Data from JSON Lines Format" << endl;
+	this->m_out << "\t 15 	-> To Replay captured Server Data from a file" << endl;
+	this->m_out << "\t 16 	-> To Write the Metrics of the last Server Read in JSON Format" << endl;
 
 	while(exitFlag == false)
 	{
 		string choice;
 
-		getUserInput("\t Enter your choice to perform the respective "
-				"operation between 0 and 12: ", "\\d+", choice);
+		getUserInput(this->m_in, this->m_out, "\t Enter your choice to perform the respective "
+				"operation between 0 and 16: ", "\\d+", choice);
 
 		int numericChoice = stoi(choice);
 
-		if(numericChoice >= 0 && numericChoice <= 12)
+		if(numericChoice >= 0 && numericChoice <= 16)
 		{
 			switch(numericChoice)
 			{
 			case 0:
 			{
-				cout << endl << "Exited Main Menu : " << numericChoice << endl;
+				this->m_out << endl << "Exited Main Menu : " << numericChoice << endl;
 				exitFlag = true;
 			}
 			break;
 			case 1:
 			{
-				cout << endl << "\t You chose option : " << numericChoice
+				this->m_out << endl << "\t You chose option : " << numericChoice
 						<< " to add new course." <<endl;
 
 				this->getUserInputsforNewCourse();
@@ -68,7 +91,7 @@ void SimpleUI::run() const
 			break;
 			case 2:
 			{
-				cout << endl << "\t You chose option : " << numericChoice
+				this->m_out << endl << "\t You chose option : " << numericChoice
 						<< " to list all courses." <<endl;
 
 				this->listCourses();
@@ -76,7 +99,7 @@ void SimpleUI::run() const
 			break;
 			case 3:
 			{
-				cout << endl << "\t You chose option : " << numericChoice
+				this->m_out << endl << "\t You chose option : " << numericChoice
 						<< " to add new student to the database." <<endl;
 
 				this->getUserInputsforNewStudent();
@@ -84,7 +107,7 @@ void SimpleUI::run() const
 			break;
 			case 4:
 			{
-				cout << endl << "\t You chose option : "
+				this->m_out << endl << "\t You chose option : "
 						<< numericChoice << " to add new enrollment." <<endl;
 
 				this->getUserInputforNewEnrollment();
@@ -92,7 +115,7 @@ void SimpleUI::run() const
 			break;
 			case 5:
 			{
-				cout << endl << "\t You chose option : "
+				this->m_out << endl << "\t You chose option : "
 						<< numericChoice << " to print the details of the student." <<endl;
 
 				this->printStudent();
@@ -100,7 +123,7 @@ void SimpleUI::run() const
 			break;
 			case 6:
 			{
-				cout << endl << "\t You chose option : "
+				this->m_out << endl << "\t You chose option : "
 						<< numericChoice << " to search specific student in database." <<endl;
 
 				this->searchStudent();
@@ -108,7 +131,7 @@ void SimpleUI::run() const
 			break;
 			case 7:
 			{
-				cout << endl << "\t You chose option : "
+				this->m_out << endl << "\t You chose option : "
 						<< numericChoice << " to update the student details." <<endl;
 
 				this->getUserInputforStudentUpdate();
@@ -118,7 +141,8 @@ void SimpleUI::run() const
 			{
 				string filename = "fileData.txt";
 
-				getUserInput("\t Enter the file name to write the data(.txt): ",
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name to write the data(.txt): ",
 						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
 
 				ofstream writeFile(filename, ios::trunc);
@@ -129,11 +153,11 @@ void SimpleUI::run() const
 
 					writeFile.close();
 
-					cout << "\n\t Student Database is written to the file" << endl;
+					this->m_out << "\n\t Student Database is written to the file" << endl;
 				}
 				else
 				{
-					cout << "Unable to open file" << endl;
+					this->m_out << "Unable to open file" << endl;
 				}
 			}
 			break;
@@ -141,7 +165,8 @@ void SimpleUI::run() const
 			{
 				string filename = "read_StudentDb.txt";
 
-				getUserInput("\t Enter the file name to read the data from(.txt): ",
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name to read the data from(.txt): ",
 						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
 
 				ifstream readFile(filename);
@@ -152,11 +177,11 @@ void SimpleUI::run() const
 
 					readFile.close();
 
-					cout << "\n\t Read the Student Database from the file" << endl;
+					this->m_out << "\n\t Read the Student Database from the file" << endl;
 				}
 				else
 				{
-					cout << "Unable to open file" << endl;
+					this->m_out << "Unable to open file" << endl;
 				}
 			}
 			break;
@@ -164,38 +189,65 @@ void SimpleUI::run() const
 			{
 				string noOfUserDate;
 
-				getUserInput("Enter the number of Student Data to be "
+				getUserInput(this->m_in, this->m_out, "Enter the number of Student Data to be "
 						"extracted from the server: ", "\\d+", noOfUserDate);
 
-				this->m_db.readStudentDataFromServer(stoul(noOfUserDate));
+				string fetchMode;
+
+				getUserInput(this->m_in, this->m_out,
+						"Fetch mode (0 - connection per record, 1 - pipelined "
+						"connection, 2 - parallel connections, 3 - asynchronous, "
+						"4 - staged pipeline): ", "[0-4]", fetchMode);
+
+				if(fetchMode == "1")
+				{
+					this->m_db.readStudentDataFromServerPipelined(stoul(noOfUserDate), this->m_out);
+				}
+				else if(fetchMode == "2")
+				{
+					string noOfConnections;
+
+					getUserInput(this->m_in, this->m_out,
+							"Enter the number of connections: ", "[1-9]\\d*", noOfConnections);
+
+					this->m_db.readStudentDataFromServerParallel(stoul(noOfUserDate),
+							this->m_out, stoul(noOfConnections));
+				}
+				else if(fetchMode == "3")
+				{
+					this->m_db.readStudentDataFromServerAsync(stoul(noOfUserDate), this->m_out);
+				}
+				else if(fetchMode == "4")
+				{
+					this->m_db.readStudentDataFromServerStaged(stoul(noOfUserDate), this->m_out);
+				}
+				else
+				{
+					this->m_db.readStudentDataFromServer(stoul(noOfUserDate), this->m_out);
+				}
 			}
 			break;
 			case 11:
 			{
 				string filename = "write_JSONData.txt";
 
-				getUserInput("\t Enter the file name to write JSON Data(.txt): ",
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name to write JSON Data(.txt): ",
 						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
 
 				ofstream writeFile(filename, ios::trunc);
 
 				if(writeFile.is_open())
 				{
-					Poco::JSON::Object::Ptr jsondata = this->m_db.toJson();
-
-					ostringstream jsonStream;
-
-					Poco::JSON::Stringifier::stringify(jsondata, jsonStream, 2, 2);
-
-					writeFile << jsonStream.str();
+					this->m_db.writeJson(writeFile);
 
 					writeFile.close();
 
-					cout << "\n\t Student Database is written to the file" << endl;
+					this->m_out << "\n\t Student Database is written to the file" << endl;
 				}
 				else
 				{
-					cout << "Unable to open file" << endl;
+					this->m_out << "Unable to open file" << endl;
 				}
 			}
 			break;
@@ -203,43 +255,129 @@ void SimpleUI::run() const
 			{
 				string filename = "read_fromJSON.txt";
 
-//				getUserInput("\t Enter the file name to read the data from(.txt): ",
+//				getUserInput(this->m_in, this->m_out,
+//						"\t Enter the file name to read the data from(.txt): ",
 //						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
 
 				ifstream readFile("read_fromJSON.txt");
 
 				if(readFile.is_open())
 				{
-					Poco::JSON::Parser parser;
+					this->m_db.readJson(readFile);
+
+					readFile.close();
+
+					this->m_out << "\n\t Read the Student Database from the JSON format" << endl;
+				}
+				else
+				{
+					this->m_out << "Unable to open file" << endl;
+				}
+			}
+			break;
+			case 13:
+			{
+				string filename = "write_JSONLines.txt";
+
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name to write JSON Lines Data(.txt): ",
+						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
+
+				ofstream writeFile(filename, ios::trunc);
+
+				if(writeFile.is_open())
+				{
+					this->m_db.writeJsonLines(writeFile);
+
+					writeFile.close();
+
+					this->m_out << "\n\t Student Database is written to the file" << endl;
+				}
+				else
+				{
+					this->m_out << "Unable to open file" << endl;
+				}
+			}
+			break;
+			case 14:
+			{
+				string filename = "write_JSONLines.txt";
+
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name to read JSON Lines Data from(.txt): ",
+						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
+
+				ifstream readFile(filename);
+
+				if(readFile.is_open())
+				{
+					this->m_db.readJsonLines(readFile);
+
+					readFile.close();
+
+					this->m_out << "\n\t Read the Student Database from the JSON Lines format" << endl;
+				}
+				else
+				{
+					this->m_out << "Unable to open file" << endl;
+				}
+			}
+			break;
+			case 15:
+			{
+				string filename = "serverData.txt";
+
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name of the captured server data(.txt): ",
+						R"([a-zA-Z0-9_-]+\.[tT][xX][tT])", filename);
 
-					Poco::Dynamic::Var result = parser.parse(readFile);
+				ifstream readFile(filename);
 
-//					if(result.isStruct())
-//					{
-						this->m_db.fromJson(result.extract<Poco::JSON::Object::Ptr>());
-//					}
+				if(readFile.is_open())
+				{
+					this->m_db.replayServerData(readFile, this->m_out);
 
 					readFile.close();
+				}
+				else
+				{
+					this->m_out << "Unable to open file" << endl;
+				}
+			}
+			break;
+			case 16:
+			{
+				string filename = "ingestionMetrics.json";
+
+				getUserInput(this->m_in, this->m_out,
+						"\t Enter the file name for the metrics(.json): ",
+						R"([a-zA-Z0-9_-]+\.[jJ][sS][oO][nN])", filename);
+
+				ofstream writeFile(filename);
+
+				if(writeFile.is_open())
+				{
+					this->m_db.writeIngestionMetrics(writeFile);
 
-					cout << "\n\t Read the Student Database from the JSON format" << endl;
+					writeFile.close();
 				}
 				else
 				{
-					cout << "Unable to open file" << endl;
+					this->m_out << "Unable to open file" << endl;
 				}
 			}
 			break;
 			default:
 			{
-				cout << endl << "ERROR: Invalid Input, "
-						"Please enter a numeric value between - [0-12]" << endl;
+				this->m_out << endl << "ERROR: Invalid Input, "
+						"Please enter a numeric value between - [0-16]" << endl;
 			}
 			}
 		}
 		else
 		{
-			cout << endl << "ERROR: Invalid Input, "
-					"Please enter a numeric value between - [0-12]" << endl;
+			this->m_out << endl << "ERROR: Invalid Input, "
+					"Please enter a numeric value between - [0-16]" << endl;
 		}
 	}
 }
@@ -249,16 +387,17 @@ void SimpleUI::getUserInputsforNewCourse() const
 	string courseKey, title, major, credits, startTime,
 	endTime, startDate, endDate, dayOfWeek, courseType, semester;
 
-	getUserInput("\t \t Enter CourseKey - (0-9): ", "\\d+", courseKey);
+	getUserInput(this->m_in, this->m_out, "\t \t Enter CourseKey - (0-9): ", "\\d+", courseKey);
 
-	getUserInput("\t \t Enter Title of the Course - (a-z/A-Z): ",
+	getUserInput(this->m_in, this->m_out, "\t \t Enter Title of the Course - (a-z/A-Z): ",
 			"[a-zA-Z]+", title);
 
 	bool isValidMajor = false;
 
 	while (!isValidMajor)
 	{
-		getUserInput("\t \t Available Majors are : Automation, Embedded Systems,"
+		getUserInput(this->m_in, this->m_out,
+				"\t \t Available Majors are : Automation, Embedded Systems,"
 				" Communication and Power\n \t \t Enter the Major in which "
 				"the Course belongs to: ", "[a-zA-Z]+", major);
 
@@ -273,35 +412,40 @@ void SimpleUI::getUserInputsforNewCourse() const
 
 		if (!isValidMajor)
 		{
-			cout << endl << "\t You entered a wrong Major" << endl;
+			this->m_out << endl << "\t You entered a wrong Major" << endl;
 		}
 	}
 
-	getUserInput("\t \t Enter the credit points of the Course - (0-9): ", "\\d+", credits);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter the credit points of the Course - (0-9): ", "\\d+", credits);
 
-	getUserInput("\t \t Enter the Semester of the Student "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Semester of the Student "
 			"studying currently - (hint: WiSe2023/SoSe2024): ", "^(SoSe|WiSe)\\d{4}", semester);
 
-	getUserInput("\t \t Enter the Course Type - Weekly(W/w)/Block(B/b): ", "[BbWw]", courseType);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter the Course Type - Weekly(W/w)/Block(B/b): ", "[BbWw]", courseType);
 	if(courseType != "B" && courseType != "b" && courseType != "W" && courseType != "w")
 	{
-		cout << endl << "\t You entered an invalid course type (hint: B/W/b/w)" << endl;
+		this->m_out << endl << "\t You entered an invalid course type (hint: B/W/b/w)" << endl;
 		return;
 	}
 
-	getUserInput("\t \t Enter the Course Start Time - HH:MM : ", R"(\d{1,2}\:\d{1,2})", startTime);
-	getUserInput("\t \t Enter the Course End Time - HH:MM : ", R"(\d{1,2}\:\d{1,2})", endTime);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter the Course Start Time - HH:MM : ", R"(\d{1,2}\:\d{1,2})", startTime);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter the Course End Time - HH:MM : ", R"(\d{1,2}\:\d{1,2})", endTime);
 
 	if(courseType == "B" || courseType == "b")
 	{
-		getUserInput("\t \t Enter the Course Start Date - dd.mm.YYYY : ",
+		getUserInput(this->m_in, this->m_out, "\t \t Enter the Course Start Date - dd.mm.YYYY : ",
 				R"((\d{1,2})\.(\d{1,2})\.(\d{4}))", startDate);
-		getUserInput("\t \t Enter the Course End Date - dd.mm.YYYY : ",
+		getUserInput(this->m_in, this->m_out, "\t \t Enter the Course End Date - dd.mm.YYYY : ",
 				R"((\d{1,2})\.(\d{1,2})\.(\d{4}))", endDate);
 	}
 	else if(courseType == "W" || courseType == "w")
 	{
-		getUserInput("\t \t Enter the Course Week - (Monday-Sunday) : ", "[a-zA-Z]+", dayOfWeek);
+		getUserInput(this->m_in, this->m_out,
+				"\t \t Enter the Course Week - (Monday-Sunday) : ", "[a-zA-Z]+", dayOfWeek);
 	}
 
 	//! Call the addNewCourse function from the StudentDb.h
@@ -314,22 +458,22 @@ void SimpleUI::getUserInputsforNewCourse() const
 	{
 	case StudentDb::RC_StudentDb_t::RC_Success:
 	{
-		cout << "\t \t \nNew Course Added" << endl;
+		this->m_out << "\t \t \nNew Course Added" << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Course_Exists:
 	{
-		cout << "\t \t \nCourse with the given details already exists in the database." << endl;
+		this->m_out << "\t \t \nCourse with the given details already exists in the database." << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Invalid_Semester_Added:
 	{
-		cout << "\t \t \nThe course tried to add has a invalid semester entry" << endl;
+		this->m_out << "\t \t \nThe course tried to add has a invalid semester entry" << endl;
 		break;
 	}
 	default:
 	{
-		cout << "\t \t \nUnexpected error during add course" << endl;
+		this->m_out << "\t \t \nUnexpected error during add course" << endl;
 		break;
 	}
 	}
@@ -337,61 +481,77 @@ void SimpleUI::getUserInputsforNewCourse() const
 
 void SimpleUI::listCourses() const
 {
-	cout << "No of Courses in Database: "<< this->m_db.getCourses().size() << endl << endl;
+	//! Written to a buffer first, the session stream may block while the courses are locked.
+	ostringstream out;
 
-	for(const pair<const int, unique_ptr<const Course>>& courses: this->m_db.getCourses())
 	{
-		const Course* course = courses.second.get();
+		StudentDb::CoursesView coursesView = this->m_db.getCourses();
 
-		if (const BlockCourse* blockcourse = dynamic_cast<const BlockCourse*>(course))
-		{
-			cout << "[Type: Block] | ";
-			cout << "[key: " << course->getcourseKey() << "] | ";
-			cout << "[Title: " << course->gettitle() << "] | ";
-			cout << "[Major: " << course->getmajorById().at(course->getmajor()) << "] | ";
-			cout << "[Credits: " << course->getcreditPoints() << "] | ";
-
-			cout << endl << "\t";
-
-			cout << "[StartDate: " << pocoDateToStringFormatter(blockcourse->getStartDate()) << "] | ";
-			cout << "[EndDate: " << pocoDateToStringFormatter(blockcourse->getEndDate()) << "] | ";
-			cout << "[StartTime: " << pocoTimeToStringFormatter(blockcourse->getStartTime()) << "] | ";
-			cout << "[EndTime: " << pocoTimeToStringFormatter(blockcourse->getEndTime()) << "]";
-		}
-		else if (const WeeklyCourse* weeklycourse = dynamic_cast<const WeeklyCourse*>(course))
+		out << "No of Courses in Database: "<< coursesView.size() << endl << endl;
+
+		for(const pair<const int, unique_ptr<const Course>>& courses: coursesView)
 		{
-			cout << "[Type: Weekly] | ";
-			cout << "[key: " << course->getcourseKey() << "] | ";
-			cout << "[Title: " << course->gettitle() << "] | ";
-			cout << "[Major: " << course->getmajorById().at(course->getmajor()) << "] | ";
-			cout << "[Credits: " << course->getcreditPoints() << "] | ";
+			const Course* course = courses.second.get();
 
-			cout << endl << "\t";
+			if (const BlockCourse* blockcourse = dynamic_cast<const BlockCourse*>(course))
+			{
+				out << "[Type: Block] | ";
+				out << "[key: " << course->getcourseKey() << "] | ";
+				out << "[Title: " << course->gettitle() << "] | ";
+				out << "[Major: " << course->getmajorById().at(course->getmajor()) << "] | ";
+				out << "[Credits: " << course->getcreditPoints() << "] | ";
+
+				out << endl << "\t";
+
+				out << "[StartDate: " << pocoDateToStringFormatter(blockcourse->getStartDate()) << "] | ";
+				out << "[EndDate: " << pocoDateToStringFormatter(blockcourse->getEndDate()) << "] | ";
+				out << "[StartTime: " << pocoTimeToStringFormatter(blockcourse->getStartTime()) << "] | ";
+				out << "[EndTime: " << pocoTimeToStringFormatter(blockcourse->getEndTime()) << "]";
+			}
+			else if (const WeeklyCourse* weeklycourse = dynamic_cast<const WeeklyCourse*>(course))
+			{
+				out << "[Type: Weekly] | ";
+				out << "[key: " << course->getcourseKey() << "] | ";
+				out << "[Title: " << course->gettitle() << "] | ";
+				out << "[Major: " << course->getmajorById().at(course->getmajor()) << "] | ";
+				out << "[Credits: " << course->getcreditPoints() << "] | ";
 
-			cout << "[WeekDay: " << weeklycourse->getDaysOfWeek() << "] | ";
-			cout << "[StartTime: " << pocoTimeToStringFormatter(weeklycourse->getStartTime()) << "] | ";
-			cout << "[EndTime: " << pocoTimeToStringFormatter(weeklycourse->getEndTime()) << "]";
-		}
+				out << endl << "\t";
+
+				out << "[WeekDay: " << weeklycourse->getDaysOfWeek() << "] | ";
+				out << "[StartTime: " << pocoTimeToStringFormatter(weeklycourse->getStartTime()) << "] | ";
+				out << "[EndTime: " << pocoTimeToStringFormatter(weeklycourse->getEndTime()) << "]";
+			}
 
-		cout << endl << endl;
+			out << endl << endl;
+		}
 	}
+
+	this->m_out << out.str();
 }
 
 void SimpleUI::getUserInputsforNewStudent() const
 {
 	string firstName, lastName, DoBstring, streetName, postalCode, cityName, additionalInfo;
 
-	getUserInput("\t \t Enter First Name of the Student - (a-z/A-Z): ", "[a-zA-Z]+", firstName);
-	getUserInput("\t \t Enter Last Name of the Student - (a-z/A-Z): ", "[a-zA-Z]+", lastName);
-	getUserInput("\t \t Enter Date of Birth of the Student - (dd.mm.YYYY): ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter First Name of the Student - (a-z/A-Z): ", "[a-zA-Z]+", firstName);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Last Name of the Student - (a-z/A-Z): ", "[a-zA-Z]+", lastName);
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Date of Birth of the Student - (dd.mm.YYYY): ",
 			R"((\d{1,2})\.(\d{1,2})\.(\d{4}))", DoBstring);
-	getUserInput("\t \t Enter Street Name of the Student's Address - (a-z/A-Z): ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Street Name of the Student's Address - (a-z/A-Z): ",
 			"[a-zA-Z0-9\\s\\p{P}]+", streetName);
-	getUserInput("\t \t Enter Post Code of the Student's Address - (0-9): ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Post Code of the Student's Address - (0-9): ",
 			"\\d+", postalCode);
-	getUserInput("\t \t Enter City Name of the Student's Address - (a-z/A-Z): ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter City Name of the Student's Address - (a-z/A-Z): ",
 			"[a-zA-Z\\s]+", cityName);
-	getUserInput("\t \t Enter Additional Info of Student's Address - (0-9/a-z/A-Z): ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Additional Info of Student's Address - (0-9/a-z/A-Z): ",
 			"[a-zA-Z0-9\\s\\p{P}]+", additionalInfo);
 
 	//! Call the addnewstudent function from the StudentDb.h
@@ -403,17 +563,17 @@ void SimpleUI::getUserInputsforNewStudent() const
 	{
 	case StudentDb::RC_StudentDb_t::RC_Success:
 	{
-		cout << "\t \t \nNew Student Added" << endl;
+		this->m_out << "\t \t \nNew Student Added" << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Student_Exists:
 	{
-		cout << "\t \t \nStudent with the given details already exists in the database." << endl;
+		this->m_out << "\t \t \nStudent with the given details already exists in the database." << endl;
 		break;
 	}
 	default:
 	{
-		cout << "\t \t \nUnexpected error during add student" << endl;
+		this->m_out << "\t \t \nUnexpected error during add student" << endl;
 		break;
 	}
 	}
@@ -423,13 +583,13 @@ void SimpleUI::getUserInputforNewEnrollment() const
 {
 	string matrikelNumber, semester, courseKey;
 
-	getUserInput("\t \t Enter the Matrikel Number of the Student, "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Matrikel Number of the Student, "
 			"to add his/her Enrollment - (0-9): ", "\\d+", matrikelNumber);
 
-	getUserInput("\t \t Enter the Semester of the Student "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Semester of the Student "
 			"studying currently - (hint: WiSe2023/SoSe2024): ", "^(SoSe|WiSe)\\d{4}", semester);
 
-	getUserInput("\t \t Enter the Course Key, "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Course Key, "
 			"to which he/she wants to enroll - 0-9: ", "\\d+", courseKey);
 
 	//! Call the addEnrollment function from the StudentDb.h
@@ -440,27 +600,27 @@ void SimpleUI::getUserInputforNewEnrollment() const
 	{
 	case StudentDb::RC_StudentDb_t::RC_Success:
 	{
-		cout << "\t \t \nNew Enrollment Added" << endl;
+		this->m_out << "\t \t \nNew Enrollment Added" << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Wrong_Course_Key:
 	{
-		cout << "\t \t \nProvided course key is incorrect or not found" << endl;
+		this->m_out << "\t \t \nProvided course key is incorrect or not found" << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Wrong_MatrikelNumber:
 	{
-		cout << "\t \t \nProvided matrikel number is incorrect or not found." << endl;
+		this->m_out << "\t \t \nProvided matrikel number is incorrect or not found." << endl;
 		break;
 	}
 	case StudentDb::RC_StudentDb_t::RC_Enrollment_Exists:
 	{
-		cout << "\t \t \nEnrollment for the student and course already exists in the database." << endl;
+		this->m_out << "\t \t \nEnrollment for the student and course already exists in the database." << endl;
 		break;
 	}
 	default:
 	{
-		cout << "\t \t \nUnexpected error during add enrollment" << endl;
+		this->m_out << "\t \t \nUnexpected error during add enrollment" << endl;
 		break;
 	}
 	}
@@ -470,83 +630,95 @@ void SimpleUI::printStudent() const
 {
 	string matrikelNumber;
 
-	getUserInput("\t \t Enter the Matrikel Number of the Student, "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Matrikel Number of the Student, "
 			"to add his/her Enrollment - (0-9): ", "\\d+", matrikelNumber);
 
-	map<int, Student>::const_iterator matrikelNumberItr =
-			this->m_db.getStudents().find(stoi(matrikelNumber));
+	//! Written to a buffer first, the session stream may block while the student is locked.
+	ostringstream out;
 
-	if(matrikelNumberItr != this->m_db.getStudents().end())
+	bool studentFound = this->m_db.readStudent(stoi(matrikelNumber), [&out](const Student& student)
 	{
-		const Student& student = matrikelNumberItr->second;
+		out << endl << "[MatrikelNumber: " << student.getMatrikelNumber() << "] | ";
+		out << "[FirstName: " << student.getFirstName() << "] | ";
+		out << "[LastName: " << student.getLastName() << "] | ";
+		out << "[DateOfBirth: " << pocoDateToStringFormatter(student.getDateOfBirth()) << "] | ";
 
-		cout << endl << "[MatrikelNumber: " << student.getMatrikelNumber() << "] | ";
-		cout << "[FirstName: " << student.getFirstName() << "] | ";
-		cout << "[LastName: " << student.getLastName() << "] | ";
-		cout << "[DateOfBirth: " << pocoDateToStringFormatter(student.getDateOfBirth()) << "] | ";
+		out << endl << "\t";
 
-		cout << endl << "\t";
+		out << "[Street: " << student.getAddress()->getstreet() << "] | ";
+		out << "[PostalCode: " << student.getAddress()->getpostalCode() << "] | ";
+		out << "[City: " << student.getAddress()->getcityName() << "] | ";
+		out << "[AdditionalInfo: " << student.getAddress()->getadditionalInfo() << "] | ";
 
-		cout << "[Street: " << student.getAddress()->getstreet() << "] | ";
-		cout << "[PostalCode: " << student.getAddress()->getpostalCode() << "] | ";
-		cout << "[City: " << student.getAddress()->getcityName() << "] | ";
-		cout << "[AdditionalInfo: " << student.getAddress()->getadditionalInfo() << "] | ";
-
-		cout << endl << "\t";
+		out << endl << "\t";
 
 		for(const Enrollment& enrollment : student.getEnrollments())
 		{
-			cout << "[CourseKey: " << enrollment.getcourse()->getcourseKey() << "] | ";
-			cout << "[Semester: " << enrollment.getsemester() << "] | ";
-			cout << "[Grade: " << enrollment.getgrade() << "] | ";
+			out << "[CourseKey: " << enrollment.getcourse()->getcourseKey() << "] | ";
+			out << "[Semester: " << enrollment.getsemester() << "] | ";
+			out << "[Grade: " << enrollment.getgrade() << "] | ";
 		}
-	}
-	else
+	});
+
+	this->m_out << out.str();
+
+	if(!studentFound)
 	{
-		cout << "\n\t \t Entered Matrikel Number does not match "
+		this->m_out << "\n\t \t Entered Matrikel Number does not match "
 				"any student in the database." << endl;
 	}
 
-	cout << endl << endl;
+	this->m_out << endl << endl;
 }
 
 void SimpleUI::searchStudent() const
 {
 	string searchString;
 
-	getUserInput("\t \t Enter Student Name to search in the Database - a-z/A-Z: ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t Enter Student Name to search in the Database - a-z/A-Z: ",
 			"[a-zA-Z]", searchString);
 
-	bool matchFound = false;
+	vector<Student> matches;
 
-	for(const pair<const int,Student> & studentsItr : this->m_db.getStudents())
 	{
-		const Student& student = studentsItr.second;
-
-		string firstName = student.getFirstName();
-		string lastName = student.getLastName();
+		//! The matches are copied out first, the session stream may block while
+		//! they are printed and the snapshot holds the courses lock.
+		ShardedStudentMap::ReadView students = this->m_db.getStudents();
 
-		if (boost::algorithm::icontains(firstName, searchString) ||
-				boost::algorithm::icontains(lastName, searchString))
+		for(const pair<const int,Student> & studentsItr : students)
 		{
-			cout << endl << "[MatrikelNumber: " << student.getMatrikelNumber() << "] | ";
-			cout << "[FirstName: " << student.getFirstName() << "] | ";
-			cout << "[LastName: " << student.getLastName() << "] | ";
-			cout << "[DateOfBirth: " << pocoDateToStringFormatter(student.getDateOfBirth()) << "] | ";
+			const Student& student = studentsItr.second;
 
-			cout << endl << "\t";
+			if (boost::algorithm::icontains(student.getFirstName(), searchString) ||
+					boost::algorithm::icontains(student.getLastName(), searchString))
+			{
+				matches.push_back(student);
+			}
+		}
+	}
 
-			cout << "[Street: " << student.getAddress()->getstreet() << "] | ";
-			cout << "[PostalCode: " << student.getAddress()->getpostalCode() << "] | ";
-			cout << "[City: " << student.getAddress()->getcityName() << "] | ";
-			cout << "[AdditionalInfo: " << student.getAddress()->getadditionalInfo() << "] | ";
+	bool matchFound = !matches.empty();
 
-			cout << endl << endl;
-		}
+	for(const Student& student : matches)
+	{
+		this->m_out << endl << "[MatrikelNumber: " << student.getMatrikelNumber() << "] | ";
+		this->m_out << "[FirstName: " << student.getFirstName() << "] | ";
+		this->m_out << "[LastName: " << student.getLastName() << "] | ";
+		this->m_out << "[DateOfBirth: " << pocoDateToStringFormatter(student.getDateOfBirth()) << "] | ";
+
+		this->m_out << endl << "\t";
+
+		this->m_out << "[Street: " << student.getAddress()->getstreet() << "] | ";
+		this->m_out << "[PostalCode: " << student.getAddress()->getpostalCode() << "] | ";
+		this->m_out << "[City: " << student.getAddress()->getcityName() << "] | ";
+		this->m_out << "[AdditionalInfo: " << student.getAddress()->getadditionalInfo() << "] | ";
+
+		this->m_out << endl << endl;
 	}
 	if(matchFound == false)
 	{
-		cout << "\t \t Entered string doesn't match the Student Name "
+		this->m_out << "\t \t Entered string doesn't match the Student Name "
 				"or the Student does not exist in the Database" << endl;
 	}
 }
@@ -555,44 +727,42 @@ void SimpleUI::getUserInputforStudentUpdate() const
 {
 	string matrikelNumber;
 
-	getUserInput("\t \t Enter the Matrikel Number of the Student, "
+	getUserInput(this->m_in, this->m_out, "\t \t Enter the Matrikel Number of the Student, "
 			"to add his/her Enrollment - (0-9): ", "\\d+", matrikelNumber);
 
-	auto studentItr =  this->m_db.getStudents().find(stoi(matrikelNumber));
-
-	if(studentItr != this->m_db.getStudents().end())
+	if(this->m_db.readStudent(stoi(matrikelNumber), [](const Student&){}))
 	{
-		cout << endl << "\t \t UPDATE STUDENT MENU: "
+		this->m_out << endl << "\t \t UPDATE STUDENT MENU: "
 				"Below are the index number to update the details" << endl << endl;
 
-		cout << "\t \t \t 0 -> To Exit Update Student Menu" << endl;
-		cout << "\t \t \t 1 -> Update First Name" << endl;
-		cout << "\t \t \t 2 -> Update Last Name" << endl;
-		cout << "\t \t \t 3 -> Update Date of Birth" << endl;
-		cout << "\t \t \t 4 -> Update Address" << endl;
-		cout << "\t \t \t 5 -> Update Enrollment" << endl;
+		this->m_out << "\t \t \t 0 -> To Exit Update Student Menu" << endl;
+		this->m_out << "\t \t \t 1 -> Update First Name" << endl;
+		this->m_out << "\t \t \t 2 -> Update Last Name" << endl;
+		this->m_out << "\t \t \t 3 -> Update Date of Birth" << endl;
+		this->m_out << "\t \t \t 4 -> Update Address" << endl;
+		this->m_out << "\t \t \t 5 -> Update Enrollment" << endl;
 
-		const Student& updateStudent = studentItr->second;
-
-		this->performStudentUpdate(studentItr->first, updateStudent);
+		this->performStudentUpdate(stoi(matrikelNumber));
 	}
 	else
 	{
-		cout << endl << "\t \t \t ERROR: Entered Matrikel Number "
+		this->m_out << endl << "\t \t \t ERROR: Entered Matrikel Number "
 				"doesn't exist in the database!!!" << endl;
 	}
 }
 
-void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
-		const Student& updateStudent) const
+void SimpleUI::performStudentUpdate(unsigned int matrikelNumber) const
 {
 	bool exitFlag = false;
 
 	while(exitFlag == false)
 	{
+		//! A copy, taken again after every update, so no lock is held while waiting for input.
+		Student updateStudent = this->m_db.getStudent(matrikelNumber);
+
 		string choice;
 
-		getUserInput("\t \t \t Enter your choice to perform "
+		getUserInput(this->m_in, this->m_out, "\t \t \t Enter your choice to perform "
 				"the respective operation between 0 and 5: ", "\\d+", choice);
 
 		int numericChoice = stoi(choice);
@@ -603,21 +773,22 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			{
 			case 0:
 			{
-				cout << endl << "\t \t Exited Student Update Menu : "
+				this->m_out << endl << "\t \t Exited Student Update Menu : "
 						<< numericChoice <<endl;
 				exitFlag = true;
 			}
 			break;
 			case 1:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to update First Name." <<endl;
 
 				string firstName;
 
-				cout << endl << "\t \t \t \t Existing First Name of the Student: "
+				this->m_out << endl << "\t \t \t \t Existing First Name of the Student: "
 						<< updateStudent.getFirstName() << endl;
-				getUserInput("\t \t \t \t Enter First Name of the Student to Update - a-z/A-Z: ",
+				getUserInput(this->m_in, this->m_out,
+						"\t \t \t \t Enter First Name of the Student to Update - a-z/A-Z: ",
 						"[a-zA-Z]+", firstName);
 
 				this->m_db.updateFirstName(firstName, matrikelNumber);
@@ -625,14 +796,15 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			break;
 			case 2:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to update Last Name." <<endl;
 
 				string lastName;
 
-				cout << endl << "\t \t \t \t Existing Last Name of the Student: "
+				this->m_out << endl << "\t \t \t \t Existing Last Name of the Student: "
 						<< updateStudent.getLastName() << endl;
-				getUserInput("\t \t \t \t Enter Last Name of the Student to Update - a-z/A-Z: ",
+				getUserInput(this->m_in, this->m_out,
+						"\t \t \t \t Enter Last Name of the Student to Update - a-z/A-Z: ",
 						"[a-zA-Z]+", lastName);
 
 				this->m_db.updateLastName(lastName, matrikelNumber);
@@ -640,14 +812,15 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			break;
 			case 3:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to update Date of Birth." <<endl;
 
 				string DoBstring = "31.12.9999";
 
-				cout << endl << "\t \t \t \t Existing Date of Birth of the Student: "
+				this->m_out << endl << "\t \t \t \t Existing Date of Birth of the Student: "
 						<< pocoDateToStringFormatter(updateStudent.getDateOfBirth()) << endl;
-				getUserInput("\t \t \t \t Enter Date of Birth of the Student "
+				getUserInput(this->m_in, this->m_out,
+						"\t \t \t \t Enter Date of Birth of the Student "
 						"to Update - dd..mm..YYY : ", R"((\d{1,2})\.(\d{1,2})\.(\d{4}))", DoBstring);
 
 				this->m_db.updateDateOfBirth(stringToPocoDateFormatter(DoBstring), matrikelNumber);
@@ -655,7 +828,7 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			break;
 			case 4:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to update Address." <<endl;
 
 				this->getUserInputforAddressUpdate(matrikelNumber, updateStudent);
@@ -663,7 +836,7 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			break;
 			case 5:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to update Enrollment." <<endl << endl;
 
 				this->getUserInputforEnrollmentUpdate(matrikelNumber, updateStudent);
@@ -671,7 +844,7 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 			break;
 			default:
 			{
-				cout << endl << "\t \t \t ERROR: Invalid Input, "
+				this->m_out << endl << "\t \t \t ERROR: Invalid Input, "
 						"Please enter a numeric value between - [0-5]" << endl;
 			}
 			break;
@@ -679,7 +852,7 @@ void SimpleUI::performStudentUpdate(unsigned int matrikelNumber,
 		}
 		else
 		{
-			cout << endl << "\t \t \t ERROR: Invalid Input, "
+			this->m_out << endl << "\t \t \t ERROR: Invalid Input, "
 					"Please enter a numeric value between - [0-5]" << endl;
 		}
 	}
@@ -690,25 +863,25 @@ void SimpleUI::getUserInputforAddressUpdate(unsigned int matrikelNumber,
 {
 	string streetName, postalCode, cityName, additionalInfo;
 
-	cout << endl << "\t \t \t \t Existing Street Name of the Student's Address: "
+	this->m_out << endl << "\t \t \t \t Existing Street Name of the Student's Address: "
 			<< updateStudent.getAddress()->getstreet() << endl;
-	getUserInput("\t \t \t \t Enter Street Name of the "
+	getUserInput(this->m_in, this->m_out, "\t \t \t \t Enter Street Name of the "
 			"Student's Address to Update - a-z/A-Z: ",
 			"[a-zA-Z0-9\\s\\p{P}]+", streetName);
 
-	cout << endl << "\t \t \t \t Existing Post Code of the Student's Address: "
+	this->m_out << endl << "\t \t \t \t Existing Post Code of the Student's Address: "
 			<< updateStudent.getAddress()->getpostalCode() << endl;
-	getUserInput("\t \t \t \t Enter Postal Code of the "
+	getUserInput(this->m_in, this->m_out, "\t \t \t \t Enter Postal Code of the "
 			"Student's Address to Update - 0-9: ", "\\d+", postalCode);
 
-	cout << endl << "\t \t \t \t Existing City Name of the Student's Address: "
+	this->m_out << endl << "\t \t \t \t Existing City Name of the Student's Address: "
 			<< updateStudent.getAddress()->getcityName() << endl;
-	getUserInput("\t \t \t \t Enter City Name of the "
+	getUserInput(this->m_in, this->m_out, "\t \t \t \t Enter City Name of the "
 			"Student's Address to Update - a-z/A-Z: ", "[a-zA-Z\\s]+", cityName);
 
-	cout << endl << "\t \t \t \t Existing Additional Info of the Student's Address: "
+	this->m_out << endl << "\t \t \t \t Existing Additional Info of the Student's Address: "
 			<< updateStudent.getAddress()->getadditionalInfo() << endl;
-	getUserInput("\t \t \t \t Enter Additional Info related "
+	getUserInput(this->m_in, this->m_out, "\t \t \t \t Enter Additional Info related "
 			"to Student's Address to Update - 0-9/a-z/A-Z: ",
 			"[a-zA-Z0-9\\s\\p{P}]+", additionalInfo);
 
@@ -721,30 +894,36 @@ void SimpleUI::getUserInputforEnrollmentUpdate(unsigned int matrikelNumber,
 {
 	if(updateStudent.getEnrollments().empty())
 	{
-		cout << endl << "\t \t \t ERROR: Entered Student not "
+		this->m_out << endl << "\t \t \t ERROR: Entered Student not "
 				"enrolled to update grade or delete enrollment!!!" << endl;
 		return;
 	}
 
 	string courseKey;
 
-	getUserInput("\t \t \t \t Enter CourseKey to perform Enrollment Update - 0-9: ",
+	getUserInput(this->m_in, this->m_out,
+			"\t \t \t \t Enter CourseKey to perform Enrollment Update - 0-9: ",
 			"\\d+", courseKey);
 
-	auto courseKeyItr = this->m_db.getCourses().find(stoi(courseKey));
+	bool courseExists;
+
+	{
+		StudentDb::CoursesView coursesView = this->m_db.getCourses();
 
+		courseExists = coursesView.find(stoi(courseKey)) != coursesView.end();
+	}
 
-	if(courseKeyItr != this->m_db.getCourses().end())
+	if(courseExists)
 	{
-		cout << endl << "\t \t \t \t 0 -> To Exit Update Enrollment Menu" << endl;
-		cout << endl << "\t \t \t \t 1 -> Delete Enrollment" << endl;
-		cout << endl << "\t \t \t \t 2 -> Update Grade" << endl;
+		this->m_out << endl << "\t \t \t \t 0 -> To Exit Update Enrollment Menu" << endl;
+		this->m_out << endl << "\t \t \t \t 1 -> Delete Enrollment" << endl;
+		this->m_out << endl << "\t \t \t \t 2 -> Update Grade" << endl;
 
 		this->performEnrollmentUpdate(courseKey, updateStudent);
 	}
 	else
 	{
-		cout << endl << "\t \t \t ERROR: Entered Course Key "
+		this->m_out << endl << "\t \t \t ERROR: Entered Course Key "
 				"doesn't exist in the database!!!" << endl;
 	}
 }
@@ -758,7 +937,7 @@ void SimpleUI::performEnrollmentUpdate(const std::string& courseKey,
 	{
 		string choice;
 
-		getUserInput("\t \t \t \t Enter your choice to perform the "
+		getUserInput(this->m_in, this->m_out, "\t \t \t \t Enter your choice to perform the "
 				"respective operation between 0-2: ", "\\d+", choice);
 
 		int numericChoice = stoi(choice);
@@ -769,28 +948,32 @@ void SimpleUI::performEnrollmentUpdate(const std::string& courseKey,
 			{
 			case 0:
 			{
-				cout << endl << "\t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t You chose option : " << numericChoice
 						<< " to exit Update Enrollment." <<endl;
 				exitFlag = true;
 			}
 			break;
 			case 1:
 			{
-				cout << endl << "\t \t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t \t You chose option : " << numericChoice
 						<< " to Delete Enrollment." <<endl;
 
-				this->m_db.deleteEnrollment(stoi(courseKey),
-						updateStudent.getMatrikelNumber());
+				if(this->m_db.deleteEnrollment(stoi(courseKey),
+						updateStudent.getMatrikelNumber()) == StudentDb::RC_StudentDb_t::RC_Success)
+				{
+					this->m_out << "Entered Enrollment Deleted!!" << endl;
+				}
 			}
 			break;
 			case 2:
 			{
-				cout << endl << "\t \t \t \t You chose option : " << numericChoice
+				this->m_out << endl << "\t \t \t \t You chose option : " << numericChoice
 						<< " to update Grade." <<endl;
 
 				string grade = "0";
 
-				getUserInput("\t \t \t \t \t Enter Grade to Update - 1.0 to 4.0: ",
+				getUserInput(this->m_in, this->m_out,
+						"\t \t \t \t \t Enter Grade to Update - 1.0 to 4.0: ",
 						"^[1-3](\\.[037])?$|^4\\.0$", grade);
 
 				this->m_db.updateGrade(stoi(courseKey), (stof(grade)),
@@ -801,7 +984,7 @@ void SimpleUI::performEnrollmentUpdate(const std::string& courseKey,
 		}
 		else
 		{
-			cout << endl << "\t \t \t ERROR: Invalid Input, "
+			this->m_out << endl << "\t \t \t ERROR: Invalid Input, "
 					"Please enter a numeric value between - [0-2]" << endl;
 		}
 	}
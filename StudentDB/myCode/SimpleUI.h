@@ -26,7 +26,22 @@ private:
 	 */
 	StudentDb& m_db;
 
+	/*!
+	 * @var m_in - The stream the user input is read from.
+	 */
+	std::istream& m_in;
+
+	/*!
+	 * @var m_out - The stream the menus and results are written to.
+	 */
+	std::ostream& m_out;
+
 private:
+	/*!
+	 * @brief The main menu loop of run().
+	 */
+	void runMenu() const;
+
 	/*!
 	 * @brief Get user inputs for creating a new course.
 	 */
@@ -73,10 +88,9 @@ private:
 	/*!
 	 * @brief Perform updates on a Student object.
 	 *
-	 * @param updateStudent Reference to a Student object.
+	 * @param matrikelNumber The matrikel number of the student.
 	 */
-	void performStudentUpdate(unsigned int matrikelNumber,
-			const Student& updateStudent) const;
+	void performStudentUpdate(unsigned int matrikelNumber) const;
 
 	/*!
 	 * @brief Get user inputs for updating student's address information.
@@ -110,11 +124,13 @@ public:
 	 * @brief Parameterized constructor for SimpleUI.
 	 *
 	 * Initializes the SimpleUI class with a reference
-	 * to a StudentDb object.
+	 * to a StudentDb object and the streams of the user.
 	 *
 	 * @param db A reference to the StudentDb class.
+	 * @param in The stream the user input is read from.
+	 * @param out The stream the menus and results are written to.
 	 */
-	SimpleUI(StudentDb& db);
+	SimpleUI(StudentDb& db, std::istream& in = std::cin, std::ostream& out = std::cout);
 
 	/*!
 	 * @brief Default destructor for the SimpleUI class.
@@ -125,6 +141,8 @@ public:
 	 * @brief Lists all the properties available in the database,
 	 * requests input from the user,
 	 *        and executes the respective operation.
+	 *
+	 * Returns when the user exits the menu or the user input ends.
 	 */
 	void run() const;
 };
@@ -0,0 +1,86 @@
+/*!
+ * @file SnapshotRegistry.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "SnapshotRegistry.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+using namespace std;
+
+SnapshotRegistry::SnapshotRegistry()
+{
+	for(atomic<uint64_t>& pinned : this->m_pinned)
+	{
+		pinned = 0;
+	}
+}
+
+unsigned int SnapshotRegistry::pin(const std::atomic<std::uint64_t> &committed,
+		std::uint64_t &version)
+{
+	//! Threads start at different slots, so they rarely compete for one.
+	unsigned int slotIdx = hash<thread::id>()(this_thread::get_id()) % maxReaders;
+
+	version = committed.load();
+
+	uint64_t freeSlot = 0;
+
+	while(!this->m_pinned[slotIdx].compare_exchange_strong(freeSlot, version))
+	{
+		freeSlot = 0;
+
+		slotIdx = (slotIdx + 1) % maxReaders;
+
+		if(slotIdx == 0)
+		{
+			this_thread::yield();
+		}
+
+		version = committed.load();
+	}
+
+	//! A writer may have missed the announcement if a version was
+	//! committed meanwhile, the newer version is pinned instead.
+	uint64_t current = committed.load();
+
+	while(current != version)
+	{
+		version = current;
+
+		this->m_pinned[slotIdx].store(version);
+
+		current = committed.load();
+	}
+
+	return slotIdx;
+}
+
+void SnapshotRegistry::unpin(unsigned int slotIdx)
+{
+	this->m_pinned[slotIdx].store(0);
+}
+
+std::uint64_t SnapshotRegistry::oldestPinned(std::uint64_t committed) const
+{
+	uint64_t oldest = committed;
+
+	for(const atomic<uint64_t>& pinned : this->m_pinned)
+	{
+		uint64_t version = pinned.load();
+
+		if(version != 0)
+		{
+			oldest = min(oldest, version);
+		}
+	}
+
+	return oldest;
+}
@@ -0,0 +1,75 @@
+/*!
+ * @file SnapshotRegistry.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef SNAPSHOTREGISTRY_H_
+#define SNAPSHOTREGISTRY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/*!
+ * @class SnapshotRegistry
+ * @brief Announces the versions pinned by the readers of a
+ * multi-version store, for epoch based reclamation.
+ *
+ * A reader pins the committed version in one of a fixed number of slots
+ * and releases the slot when it is done, both without locking. A writer
+ * may free an old version once oldestPinned() is not older than the
+ * version that replaced it, since no reader can reach it any more.
+ */
+class SnapshotRegistry
+{
+public:
+	/*!
+	 * @brief Number of readers that can pin a version at the same time,
+	 * further readers wait for a free slot.
+	 */
+	static const unsigned int maxReaders = 128;
+
+private:
+	/*!
+	 * @var m_pinned - The pinned version per slot, 0 marks a free slot.
+	 */
+	std::array<std::atomic<std::uint64_t>, maxReaders> m_pinned;
+
+public:
+	/*!
+	 * @brief Constructor with all slots free.
+	 */
+	SnapshotRegistry();
+
+	/*!
+	 * @brief Pins the committed version.
+	 *
+	 * The version is announced before it is confirmed, so a writer
+	 * reading the announcements never misses a reader it could harm.
+	 *
+	 * @param committed The latest committed version, at least 1.
+	 * @param version Receives the pinned version.
+	 * @return The slot to be passed to unpin().
+	 */
+	unsigned int pin(const std::atomic<std::uint64_t>& committed, std::uint64_t& version);
+
+	/*!
+	 * @brief Releases a slot returned by pin().
+	 */
+	void unpin(unsigned int slotIdx);
+
+	/*!
+	 * @brief Returns the oldest pinned version.
+	 *
+	 * @param committed The committed version, loaded before the call.
+	 * @return The oldest pinned version, committed if it is older
+	 * or no version is pinned.
+	 */
+	std::uint64_t oldestPinned(std::uint64_t committed) const;
+};
+
+#endif /* SNAPSHOTREGISTRY_H_ */
@@ -0,0 +1,288 @@
+/*!
+ * @file SpscRing.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef SPSCRING_H_
+#define SPSCRING_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * @class SpscRing
+ * @brief A lock-free ring buffer between exactly one producer
+ * thread and exactly one consumer thread.
+ *
+ * The producer only writes m_tail and the consumer only writes m_head,
+ * each index on its own cache line. push() waits while the ring is full,
+ * which throttles the producer to the speed of the consumer. Once the
+ * producer has called close(), pop() drains the remaining elements and
+ * then returns false.
+ *
+ * A waiting thread retries a few times and then blocks on a condition
+ * variable, so a stage waiting for the network does not occupy a core.
+ * The other thread only takes the mutex to wake it if it is blocked.
+ */
+template<typename T>
+class SpscRing
+{
+private:
+	/*!
+	 * @var m_slots - The elements, the capacity is a power of two.
+	 */
+	std::vector<T> m_slots;
+
+	/*!
+	 * @var m_mask - Maps an index to its slot.
+	 */
+	const std::size_t m_mask;
+
+	/*!
+	 * @var m_head - Number of elements taken by the consumer.
+	 */
+	alignas(64) std::atomic<std::size_t> m_head;
+
+	/*!
+	 * @var m_tail - Number of elements added by the producer.
+	 */
+	alignas(64) std::atomic<std::size_t> m_tail;
+
+	/*!
+	 * @var m_closed - True once the producer has added its last element.
+	 */
+	alignas(64) std::atomic<bool> m_closed;
+
+	/*!
+	 * @var m_producerBlocked, m_consumerBlocked - True while the thread
+	 * is blocked or about to block.
+	 */
+	std::atomic<bool> m_producerBlocked;
+	std::atomic<bool> m_consumerBlocked;
+
+	/*!
+	 * @var m_waitMutex - Used with m_notFull and m_notEmpty, only
+	 * taken to block and to wake up a blocked thread.
+	 */
+	std::mutex m_waitMutex;
+
+	/*!
+	 * @var m_notFull - Signalled when the consumer took an element.
+	 */
+	std::condition_variable m_notFull;
+
+	/*!
+	 * @var m_notEmpty - Signalled when the producer added an element
+	 * or closed the ring.
+	 */
+	std::condition_variable m_notEmpty;
+
+	/*!
+	 * @brief Number of retries before a waiting thread blocks.
+	 */
+	static const unsigned int maxSpins = 64;
+
+	/*!
+	 * @brief Rounds the capacity up to a power of two.
+	 */
+	static std::size_t roundedCapacity(std::size_t capacity)
+	{
+		std::size_t rounded = 2;
+
+		while(rounded < capacity)
+		{
+			rounded *= 2;
+		}
+
+		return rounded;
+	}
+
+	/*!
+	 * @brief Wakes up the other thread if it is blocked.
+	 *
+	 * The fence orders the change of the indices before the check of the
+	 * flag, the blocking thread sets its flag before it checks the indices,
+	 * so at least one of them sees the other.
+	 */
+	void wakeUp(std::atomic<bool>& blocked, std::condition_variable& condition)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if(blocked.load(std::memory_order_relaxed))
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->m_waitMutex);
+			}
+
+			condition.notify_one();
+		}
+	}
+
+public:
+	/*!
+	 * @brief Constructor of an empty ring.
+	 *
+	 * @param capacity Minimum number of elements the ring holds.
+	 */
+	explicit SpscRing(std::size_t capacity) :
+		m_slots(roundedCapacity(capacity)), m_mask(m_slots.size() - 1),
+		m_head(0), m_tail(0), m_closed(false), m_producerBlocked(false),
+		m_consumerBlocked(false)
+	{
+	}
+
+	/*!
+	 * @brief Adds an element if the ring has room, producer only.
+	 *
+	 * @param element The element, moved into the ring on success.
+	 * @return False if the ring is full.
+	 */
+	bool tryPush(T& element)
+	{
+		std::size_t tail = this->m_tail.load(std::memory_order_relaxed);
+
+		if(tail - this->m_head.load(std::memory_order_acquire) == this->m_slots.size())
+		{
+			return false;
+		}
+
+		this->m_slots[tail & this->m_mask] = std::move(element);
+
+		this->m_tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	 * @brief Takes the oldest element if there is one, consumer only.
+	 *
+	 * @param element Receives the element.
+	 * @return False if the ring is empty.
+	 */
+	bool tryPop(T& element)
+	{
+		std::size_t head = this->m_head.load(std::memory_order_relaxed);
+
+		if(head == this->m_tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		element = std::move(this->m_slots[head & this->m_mask]);
+
+		this->m_head.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	 * @brief Adds an element, waits while the ring is full, producer only.
+	 *
+	 * @param element The element to be added.
+	 */
+	void push(T element)
+	{
+		unsigned int spins = 0;
+
+		while(!this->tryPush(element))
+		{
+			if(++spins < maxSpins)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(this->m_waitMutex);
+
+			this->m_producerBlocked.store(true, std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			this->m_notFull.wait(lock, [this, &element]() { return this->tryPush(element); });
+
+			this->m_producerBlocked.store(false, std::memory_order_relaxed);
+
+			break;
+		}
+
+		this->wakeUp(this->m_consumerBlocked, this->m_notEmpty);
+	}
+
+	/*!
+	 * @brief Takes the oldest element, waits while the ring is empty,
+	 * consumer only.
+	 *
+	 * @param element Receives the element.
+	 * @return False if the ring is closed and empty.
+	 */
+	bool pop(T& element)
+	{
+		unsigned int spins = 0;
+
+		bool popped = false;
+
+		while(!(popped = this->tryPop(element)))
+		{
+			if(this->m_closed.load(std::memory_order_acquire))
+			{
+				//! Elements added just before close() are still taken.
+				popped = this->tryPop(element);
+				break;
+			}
+
+			if(++spins < maxSpins)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(this->m_waitMutex);
+
+			this->m_consumerBlocked.store(true, std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			this->m_notEmpty.wait(lock, [this, &element, &popped]()
+			{
+				popped = this->tryPop(element);
+
+				return popped || this->m_closed.load(std::memory_order_acquire);
+			});
+
+			this->m_consumerBlocked.store(false, std::memory_order_relaxed);
+
+			if(!popped)
+			{
+				popped = this->tryPop(element);
+			}
+
+			break;
+		}
+
+		if(popped)
+		{
+			this->wakeUp(this->m_producerBlocked, this->m_notFull);
+		}
+
+		return popped;
+	}
+
+	/*!
+	 * @brief Marks the end of the elements, producer only.
+	 */
+	void close()
+	{
+		this->m_closed.store(true, std::memory_order_release);
+
+		this->wakeUp(this->m_consumerBlocked, this->m_notEmpty);
+	}
+};
+
+#endif /* SPSCRING_H_ */
@@ -9,16 +9,38 @@
 
 #include "Student.h"
 
+#include "ModelFields.h"
+
 using namespace std;
 
-unsigned int Student::m_nextMatrikelNumber = 100000;
+MatrikelAllocator Student::m_matrikelAllocator(100000);
 
 Student::Student(std::string firstName, std::string lastName,
 		Poco::Data::Date dateOfBirth, std::shared_ptr<Address> address) :
-		m_matrikelNumber(Student::m_nextMatrikelNumber++),
+		m_matrikelNumber(Student::m_matrikelAllocator.allocate()),
 		m_firstName(firstName), m_lastName(lastName),
-		m_dateOfBirth(dateOfBirth), m_address(address)
+		m_dateOfBirth(dateOfBirth), m_gradedCredits(0), m_weightedGradeSum(0),
+		m_address(address)
+{
+}
+
+Student::Student(unsigned int matrikelNumber, std::string firstName,
+		std::string lastName, Poco::Data::Date dateOfBirth,
+		std::shared_ptr<Address> address) :
+		m_matrikelNumber(matrikelNumber),
+		m_firstName(firstName), m_lastName(lastName),
+		m_dateOfBirth(dateOfBirth), m_gradedCredits(0), m_weightedGradeSum(0),
+		m_address(address)
+{
+	Student::m_matrikelAllocator.restore(matrikelNumber);
+}
+
+Student::Student(unsigned int matrikelNumber, const Student &student) :
+		Student(student)
 {
+	this->m_matrikelNumber = matrikelNumber;
+
+	Student::m_matrikelAllocator.restore(matrikelNumber);
 }
 
 Student::~Student()
@@ -50,14 +72,49 @@ const std::vector<Enrollment>& Student::getEnrollments() const
 	return this->m_enrollments;
 }
 
+float Student::getGpa() const
+{
+	if(this->m_gradedCredits <= 0)
+	{
+		return 0;
+	}
+
+	return this->m_weightedGradeSum / this->m_gradedCredits;
+}
+
+double Student::getGradedCredits() const
+{
+	return this->m_gradedCredits;
+}
+
+void Student::accountGrade(const Enrollment &enrollment, int sign)
+{
+	if(enrollment.getgrade() == 0)
+	{
+		return;
+	}
+
+	double creditPoints = enrollment.getcourse()->getcreditPoints();
+
+	this->m_gradedCredits += sign * creditPoints;
+	this->m_weightedGradeSum += sign * creditPoints * enrollment.getgrade();
+
+	//! Guards against rounding leftovers once the last graded enrollment is gone.
+	if(this->m_gradedCredits <= 0)
+	{
+		this->m_gradedCredits = 0;
+		this->m_weightedGradeSum = 0;
+	}
+}
+
 const std::shared_ptr<Address> Student::getAddress() const
 {
 	return this->m_address;
 }
 
-void Student::setNextMatrikelNumber(unsigned int newMatrikelnumber)
+MatrikelAllocator& Student::getMatrikelAllocator()
 {
-	m_nextMatrikelNumber = newMatrikelnumber;
+	return Student::m_matrikelAllocator;
 }
 
 void Student::setFirstName(const std::string &firstName)
@@ -107,7 +164,8 @@ void Student::deleteEnrollment(const unsigned int &courseKey)
 	{
 		if(itr->getcourse()->getcourseKey() == courseKey)
 		{
-			cout << "Entered Enrollment Deleted!!" << endl;
+			this->accountGrade(*itr, -1);
+
 			itr = this->m_enrollments.erase(itr);
 		}
 		else
@@ -124,7 +182,11 @@ void Student::updateGrade(const float &grade, const unsigned int &courseKey)
 	{
 		if(itr->getcourse()->getcourseKey() == courseKey)
 		{
+			this->accountGrade(*itr, -1);
+
 			itr->setgrade(grade);
+
+			this->accountGrade(*itr, 1);
 			break;
 		}
 	}
@@ -132,10 +194,9 @@ void Student::updateGrade(const float &grade, const unsigned int &courseKey)
 
 void Student::write(std::ostream &out) const
 {
-	out << to_string(this->m_matrikelNumber)
-						<< ";" << this->m_firstName
-						<< ";" << this->m_lastName << ";"
-						<< datetoString(this->m_dateOfBirth) + ";";
+	writeFieldsText(out, *this, studentFields());
+
+	out << ";";
 
 	this->getAddress()->write(out);
 }
@@ -146,31 +207,20 @@ Student Student::read(std::istream &in)
 
 	getline(in, inStr);
 
-	unsigned int matrikelNumber = stoul(splitAt(inStr, ';'));
-
-	Student::m_nextMatrikelNumber = matrikelNumber;
-
-	string firstName = splitAt(inStr, ';');
-	string lastName = splitAt(inStr, ';');
-	Poco::Data::Date dateOfBirth = stringToPocoDateFormatter(splitAt(inStr, ';'));
+	auto values = readFieldsText(inStr, studentFields());
 
 	istringstream iss(inStr);
 
 	shared_ptr<Address> address = Address::read(iss);
 
-	Student addStudent(firstName, lastName, dateOfBirth, address);
-
-	return addStudent;
+	return Student(get<0>(values), get<1>(values), get<2>(values), get<3>(values), address);
 }
 
 Poco::JSON::Object::Ptr Student::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	returnObj->set("firstName", this->m_firstName);
-	returnObj->set("lastName", this->m_lastName);
-	returnObj->set("dateOfBirth", datetoString(this->m_dateOfBirth));
-	returnObj->set("matrikelNumber", this->m_matrikelNumber);
+	writeFieldsJson(*returnObj, *this, studentFields());
 
 	returnObj->set("address", getAddress()->toJson());
 
@@ -202,21 +252,57 @@ std::string Student::datetoString(const Poco::Data::Date date) const
 
 Student Student::fromJson(Poco::JSON::Object::Ptr data)
 {
-	Poco::DynamicStruct jsonDataStruct = *data;
+	auto values = readFieldsJson(*data, studentFields());
+
+	Poco::JSON::Object::Ptr addressData = data->getObject("address");
+
+	if(addressData.isNull())
+	{
+		throw Poco::NotFoundException("Incomplete student JSON data");
+	}
+
+	shared_ptr<Address> address = Address::fromJson(addressData);
+
+	return Student(get<0>(values), get<1>(values), get<2>(values), get<3>(values), address);
+}
+
+void Student::writeBinary(std::ostream &out) const
+{
+	writeFieldsBinary(out, *this, studentFields());
+
+	this->getAddress()->writeBinary(out);
+
+	writeLittleEndian<uint32_t>(out, this->m_enrollments.size());
+
+	for(const Enrollment& enrollment : this->m_enrollments)
+	{
+		enrollment.writeBinary(out);
+	}
+}
 
-	string firstName = jsonDataStruct["firstName"].toString();
-	string lastName = jsonDataStruct["lastName"].toString();
-	string dateOfBirthStr = jsonDataStruct["dateOfBirth"].toString();
+Student Student::readBinary(std::istream &in,
+		const std::map<int, std::unique_ptr<const Course>>& courses)
+{
+	auto values = readFieldsBinary(in, studentFields());
 
-	Poco::Data::Date dateOfBirth = stringToPocoDateFormatter(dateOfBirthStr);
+	shared_ptr<Address> address = Address::readBinary(in);
 
-	unsigned int matrikelNumber = jsonDataStruct["matrikelNumber"];
+	Student readStudent(get<0>(values), get<1>(values), get<2>(values),
+			get<3>(values), address);
 
-	Student::m_nextMatrikelNumber = matrikelNumber;
+	uint32_t noOfEnrollments = readLittleEndian<uint32_t>(in);
 
-	const Poco::JSON::Object::Ptr addressData = data->getObject("address");
+	for(uint32_t idx = 0; idx < noOfEnrollments; idx++)
+	{
+		Enrollment enrollment = Enrollment::readBinary(in, courses);
 
-	std::shared_ptr<Address> address = Address::fromJson(addressData);
+		if(enrollment.getcourse() != nullptr)
+		{
+			readStudent.addEnrollment(enrollment.getsemester(), enrollment.getcourse());
+			readStudent.updateGrade(enrollment.getgrade(),
+					enrollment.getcourse()->getcourseKey());
+		}
+	}
 
-	return Student(firstName, lastName, dateOfBirth, address);
+	return readStudent;
 }
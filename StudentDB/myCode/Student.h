@@ -13,9 +13,11 @@
 #include <sstream>
 #include <vector>
 #include <memory>
+#include <map>
 
 #include "Enrollment.h"
 #include "Address.h"
+#include "MatrikelAllocator.h"
 
 #include <Poco/Exception.h>
 
@@ -28,10 +30,10 @@ class Student
 {
 private:
 	/*!
-	 * @var m_nextMatrikelNumber - Next Matrikel Number
-	 * incremented after assigning to a student.
+	 * @var m_matrikelAllocator - Hands out the Matrikel Numbers
+	 * of new students.
 	 */
-	static unsigned int m_nextMatrikelNumber;
+	static MatrikelAllocator m_matrikelAllocator;
 
 	/*!
 	 * @var m_matrikelNumber - A student's Matrikel Number.
@@ -58,6 +60,24 @@ private:
 	 */
 	std::vector<Enrollment> m_enrollments;
 
+	/*!
+	 * @var m_gradedCredits - Sum of the credit points of the graded
+	 * enrollments, kept up to date with m_enrollments.
+	 */
+	double m_gradedCredits;
+
+	/*!
+	 * @var m_weightedGradeSum - Sum of grade times credit points of the
+	 * graded enrollments, kept up to date with m_enrollments.
+	 */
+	double m_weightedGradeSum;
+
+	/*!
+	 * @brief Adds an enrollment to the running sums, or removes it if
+	 * sign is -1. Enrollments with grade 0 are not graded yet.
+	 */
+	void accountGrade(const Enrollment& enrollment, int sign);
+
 	/*!
 	 * @var m_address - A shared pointer that holds the
 	 * details of the Address class.
@@ -79,6 +99,31 @@ public:
 	Student(std::string firstName, std::string lastName,
 			Poco::Data::Date dateOfBirth, std::shared_ptr<Address> address);
 
+	/*!
+	 * @brief Parameterized constructor for a student with a given
+	 * Matrikel number, e.g. read from a file.
+	 *
+	 * The number is restored in the allocator, so it is not handed
+	 * out to a new student later.
+	 *
+	 * @param matrikelNumber Student's Matrikel number.
+	 * @param firstName Student's first name.
+	 * @param lastName Student's last name.
+	 * @param dateOfBirth Student's date of birth.
+	 * @param address Shared pointer to the Address class.
+	 */
+	Student(unsigned int matrikelNumber, std::string firstName, std::string lastName,
+			Poco::Data::Date dateOfBirth, std::shared_ptr<Address> address);
+
+	/*!
+	 * @brief Constructor of a copy of a student under another Matrikel
+	 * number, e.g. when its number was taken meanwhile.
+	 *
+	 * @param matrikelNumber The new Matrikel number, restored in the allocator.
+	 * @param student The student to be copied, with its enrollments.
+	 */
+	Student(unsigned int matrikelNumber, const Student& student);
+
 	/*!
 	 * @brief Default destructor for the Student class.
 	 */
@@ -119,6 +164,20 @@ public:
 	 */
 	const std::vector<Enrollment>& getEnrollments() const;
 
+	/*!
+	 * @brief Getter method for the credit weighted grade point average.
+	 *
+	 * Taken from running sums, so it does not visit the enrollments.
+	 *
+	 * @return The average grade, 0 if no enrollment is graded yet.
+	 */
+	float getGpa() const;
+
+	/*!
+	 * @brief Getter method for the credit points of the graded enrollments.
+	 */
+	double getGradedCredits() const;
+
 	/*!
 	 * @brief Getter method to obtain the Address class.
 	 *
@@ -128,12 +187,12 @@ public:
 	const std::shared_ptr<Address> getAddress() const;
 
 	/*!
-	 * @brief Setter method that sets the next Matrikel
-	 * number for new students.
+	 * @brief Getter method for the allocator of the Matrikel
+	 * numbers of new students.
 	 *
-	 * @param newMatrikelNumber The new Matrikel number to set.
+	 * @return The allocator, e.g. to reserve a block for a bulk load.
 	 */
-	static void setNextMatrikelNumber(unsigned int newMatrikelNumber);
+	static MatrikelAllocator& getMatrikelAllocator();
 
 	/**
 	 * @brief Set the first name of the student.
@@ -249,6 +308,28 @@ public:
 	 */
 	static Student fromJson(Poco::JSON::Object::Ptr data);
 
+	/*!
+	 * @brief Write the student's data in the binary format.
+	 *
+	 * Writes the fields of the student, the address and the enrollments.
+	 *
+	 * @param out The output stream where the student's data will be written.
+	 */
+	void writeBinary(std::ostream& out) const;
+
+	/*!
+	 * @brief Read a Student written by writeBinary().
+	 *
+	 * Enrollments in courses that are not in courses are dropped.
+	 *
+	 * @param in The input stream from which the Student will be read.
+	 * @param courses The courses the enrollments refer to.
+	 * @return The constructed Student object.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static Student readBinary(std::istream& in,
+			const std::map<int, std::unique_ptr<const Course>>& courses);
+
 };
 
 #endif /* STUDENT_H_ */
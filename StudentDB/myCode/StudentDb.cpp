@@ -9,9 +9,22 @@
 
 #include "StudentDb.h"
 
+#include "JsonImportHandler.h"
+#include "JsonFieldReader.h"
+#include "ModelFields.h"
+#include "BoundedQueue.h"
+#include "AsyncServerIngestion.h"
+#include "SpscRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+
 using namespace std;
 
-StudentDb::StudentDb()
+StudentDb::StudentDb() : m_serverHost("www.hhs.users.h-da.cloud"), m_serverPort(4242),
+		m_workers(WorkStealingPool::shared())
 {
 }
 
@@ -19,14 +32,124 @@ StudentDb::~StudentDb()
 {
 }
 
-const std::map<int, Student>& StudentDb::getStudents() const
+void StudentDb::setServerEndpoint(const std::string &host, unsigned short port)
+{
+	this->m_serverHost = host;
+	this->m_serverPort = port;
+}
+
+StudentDb::CoursesView::CoursesView(const StudentDb &db) :
+		m_lock(db.m_coursesMutex), m_courses(&db.m_courses)
+{
+}
+
+std::map<int, std::unique_ptr<const Course>>::const_iterator
+StudentDb::CoursesView::begin() const
+{
+	return this->m_courses->begin();
+}
+
+std::map<int, std::unique_ptr<const Course>>::const_iterator
+StudentDb::CoursesView::end() const
+{
+	return this->m_courses->end();
+}
+
+std::size_t StudentDb::CoursesView::size() const
+{
+	return this->m_courses->size();
+}
+
+std::map<int, std::unique_ptr<const Course>>::const_iterator
+StudentDb::CoursesView::find(int courseKey) const
+{
+	return this->m_courses->find(courseKey);
+}
+
+ShardedStudentMap::ReadView StudentDb::getStudents() const
+{
+	//! The courses are locked first, the enrollments point to them.
+	return this->m_students.view(shared_lock<shared_timed_mutex>(this->m_coursesMutex));
+}
+
+StudentDb::CoursesView StudentDb::getCourses() const
+{
+	return CoursesView(*this);
+}
+
+std::size_t StudentDb::getNoOfStudents() const
+{
+	return this->m_students.size();
+}
+
+bool StudentDb::readStudent(unsigned int matrikelNumber,
+		const std::function<void(const Student&)>& reader) const
+{
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	return this->m_students.read(matrikelNumber, reader);
+}
+
+Student StudentDb::getStudent(unsigned int matrikelNumber) const
+{
+	shared_ptr<Student> copy;
+
+	if(!this->readStudent(matrikelNumber,
+			[&copy](const Student& student){ copy = make_shared<Student>(student); }))
+	{
+		throw out_of_range("No student with matrikel number " + to_string(matrikelNumber));
+	}
+
+	return *copy;
+}
+
+void StudentDb::writeIngestionMetrics(std::ostream &out) const
+{
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
+
+	this->m_ingestionMetrics.writeJson(out);
+}
+
+std::vector<std::pair<unsigned int, float>> StudentDb::rankByGpa() const
 {
-	return this->m_students;
+	vector<pair<unsigned int, float>> ranking;
+
+	ShardedStudentMap::ReadView students = this->getStudents();
+
+	ranking.reserve(students.size());
+
+	for(const pair<const int, Student>& student : students)
+	{
+		if(student.second.getGradedCredits() > 0)
+		{
+			ranking.emplace_back(student.first, student.second.getGpa());
+		}
+	}
+
+	//! The snapshot is sorted by matrikel number, which stays the order of equal averages.
+	stable_sort(ranking.begin(), ranking.end(),
+			[](const pair<unsigned int, float>& lhs, const pair<unsigned int, float>& rhs)
+			{ return lhs.second < rhs.second; });
+
+	return ranking;
 }
 
-const std::map<int, std::unique_ptr<const Course> >& StudentDb::getCourses() const
+CourseStatistics StudentDb::getCourseStatistics(int courseKey) const
 {
-	return this->m_courses;
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	if(this->m_courses.find(courseKey) == this->m_courses.end())
+	{
+		throw out_of_range("No course with key " + to_string(courseKey));
+	}
+
+	lock_guard<mutex> statisticsLock(this->m_courseStatisticsMutex);
+
+	map<int, CourseStatistics>::const_iterator statistics =
+			this->m_courseStatistics.find(courseKey);
+
+	return (statistics != this->m_courseStatistics.end()) ? statistics->second
+			: CourseStatistics();
 }
 
 StudentDb::RC_StudentDb_t
@@ -35,6 +158,8 @@ StudentDb::addNewCourse(std::string &courseKey, std::string &title,
 		std::string &startTime, std::string &endTime, std::string &startDate,
 		std::string &endDate, std::string &dayOfWeek)
 {
+	unique_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
 	//! using for loop to iterate over each of the courses in map
 	for(const pair<const int, unique_ptr<const Course>>& itr : this->m_courses)
 	{
@@ -81,28 +206,36 @@ StudentDb::addNewStudent(std::string &firstName, std::string &lastName,
 		std::string &postalCode, std::string &cityName,
 		std::string &additionalInfo)
 {
-	//! using for loop to find m_students if they exist already.
-	for(const pair<const int,Student>& itr : this->m_students)
+	//! The fingerprint of name and address finds an existing student in O(1).
+	uint64_t fingerprint = studentFingerprint(firstName, lastName, streetName,
+			stoi(postalCode), cityName, additionalInfo);
+
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	shared_ptr<Address> address =
+			make_shared<Address>(streetName, stoi(postalCode), cityName, additionalInfo);
+
+	Poco::Data::Date dateOfBirth = stringToPocoDateFormatter(DoBstring);
+
 	{
-		const Student& student = itr.second;
+		//! Checked and taken at once, so two threads cannot add the same student.
+		lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
 
-		if(student.getFirstName() == firstName &&
-				student.getLastName() == lastName &&
-				student.getAddress()->getstreet() == streetName &&
-				student.getAddress()->getcityName() == cityName &&
-				student.getAddress()->getpostalCode() == stoi(postalCode) &&
-				student.getAddress()->getadditionalInfo() == additionalInfo)
+		if(this->m_studentFingerprints.contains(fingerprint))
 		{
 			return RC_StudentDb_t::RC_Student_Exists;
 		}
-	}
 
-	shared_ptr<Address> address =
-			make_shared<Address>(streetName, stoi(postalCode), cityName, additionalInfo);
+		this->m_studentFingerprints.insert(fingerprint);
+	}
 
-	Student student(firstName, lastName, stringToPocoDateFormatter(DoBstring), address);
+	Student student(firstName, lastName, dateOfBirth, address);
 
-	this->m_students.insert(make_pair(student.getMatrikelNumber(), student));
+	//! A concurrent load may have restored the allocated number meanwhile.
+	while(!this->m_students.insert(student))
+	{
+		student = Student(Student::getMatrikelAllocator().allocate(), student);
+	}
 
 	return RC_StudentDb_t::RC_Success;
 }
@@ -111,58 +244,93 @@ StudentDb::RC_StudentDb_t
 StudentDb::addEnrollment(std::string &matrikelNumber,
 		std::string &semester, std::string &courseKey)
 {
-	map<int, Student>::iterator findStudent = this->m_students.find(stoul(matrikelNumber));
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	RC_StudentDb_t result = RC_StudentDb_t::RC_Wrong_MatrikelNumber;
 
-	if(findStudent != this->m_students.end())
+	this->m_students.update(stoul(matrikelNumber), [&](Student& student)
 	{
 		map<int, unique_ptr<const Course>>::iterator findCourse = this->m_courses.find(stoul(courseKey));
 
 		if(findCourse != this->m_courses.end())
 		{
-			const vector<Enrollment>& enrollments = findStudent->second.getEnrollments();
+			const vector<Enrollment>& enrollments = student.getEnrollments();
 
 			for(const Enrollment& enrollmentItr : enrollments)
 			{
 				if(enrollmentItr.getcourse()->getcourseKey() == stoul(courseKey) &&
 						enrollmentItr.getsemester() == semester)
 				{
-					return RC_StudentDb_t::RC_Enrollment_Exists;
+					result = RC_StudentDb_t::RC_Enrollment_Exists;
+
+					return;
 				}
 			}
 
 			const Course& courseref = *(findCourse->second);
 
-			findStudent->second.addEnrollment(semester, &courseref);
+			this->accountEnrollments(student.getEnrollments(), -1, findCourse->first);
+
+			student.addEnrollment(semester, &courseref);
 
-			return RC_StudentDb_t::RC_Success;
+			this->accountEnrollments(student.getEnrollments(), 1, findCourse->first);
+
+			result = RC_StudentDb_t::RC_Success;
 		}
 		else
 		{
-			return RC_StudentDb_t::RC_Wrong_Course_Key;
+			result = RC_StudentDb_t::RC_Wrong_Course_Key;
 		}
-	}
-	else
+	});
+
+	return result;
+}
+
+void StudentDb::updateStudent(unsigned int matrikelNumber,
+		const std::function<void(Student&)>& writer)
+{
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	if(!this->m_students.update(matrikelNumber, writer))
 	{
-		return RC_StudentDb_t::RC_Wrong_MatrikelNumber;
+		throw out_of_range("No student with matrikel number " + to_string(matrikelNumber));
 	}
 }
 
+void StudentDb::updateStudentIdentity(unsigned int matrikelNumber,
+		const std::function<void(Student&)>& writer)
+{
+	this->updateStudent(matrikelNumber, [this, &writer](Student& student)
+	{
+		lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+		this->m_studentFingerprints.erase(studentFingerprint(student));
+
+		writer(student);
+
+		this->m_studentFingerprints.insert(studentFingerprint(student));
+	});
+}
+
 void StudentDb::updateFirstName(const std::string &newFirstName,
 		unsigned int matrikelNumber)
 {
-	this->m_students.at(matrikelNumber).setFirstName(newFirstName);
+	this->updateStudentIdentity(matrikelNumber,
+			[&newFirstName](Student& student){ student.setFirstName(newFirstName); });
 }
 
 void StudentDb::updateLastName(const std::string &newLastName,
 		unsigned int matrikelNumber)
 {
-	this->m_students.at(matrikelNumber).setLastName(newLastName);
+	this->updateStudentIdentity(matrikelNumber,
+			[&newLastName](Student& student){ student.setLastName(newLastName); });
 }
 
 void StudentDb::updateDateOfBirth(const Poco::Data::Date &dateOfBirth,
 		unsigned int matrikelNumber)
 {
-	this->m_students.at(matrikelNumber).setDateOfBirth(dateOfBirth);
+	this->updateStudent(matrikelNumber,
+			[&dateOfBirth](Student& student){ student.setDateOfBirth(dateOfBirth); });
 }
 
 void StudentDb::updateAddress(const std::string &street,
@@ -172,26 +340,74 @@ void StudentDb::updateAddress(const std::string &street,
 	shared_ptr<Address> address =
 			make_shared<Address>(street, postalCode, cityName, additionalInfo);
 
-	this->m_students.at(matrikelNumber).setAddress(address);
+	this->updateStudentIdentity(matrikelNumber,
+			[&address](Student& student){ student.setAddress(address); });
 }
 
-void StudentDb::deleteEnrollment(const unsigned int &courseKey,
+StudentDb::RC_StudentDb_t
+StudentDb::deleteEnrollment(const unsigned int &courseKey,
 		const unsigned int matrikelNumber)
 {
-	this->m_students.at(matrikelNumber).deleteEnrollment(courseKey);
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	RC_StudentDb_t result = RC_StudentDb_t::RC_Wrong_MatrikelNumber;
+
+	this->m_students.update(matrikelNumber, [&](Student& student)
+	{
+		result = isEnrolled(student, courseKey) ? RC_StudentDb_t::RC_Success
+				: RC_StudentDb_t::RC_Wrong_Course_Key;
+
+		this->accountEnrollments(student.getEnrollments(), -1, courseKey);
+
+		student.deleteEnrollment(courseKey);
+	});
+
+	return result;
 }
 
-void StudentDb::updateGrade(const unsigned int &courseKey, const float &newGrade,
+StudentDb::RC_StudentDb_t
+StudentDb::updateGrade(const unsigned int &courseKey, const float &newGrade,
 		const unsigned int matrikelNumber)
 {
-	this->m_students.at(matrikelNumber).updateGrade(newGrade, courseKey);
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	RC_StudentDb_t result = RC_StudentDb_t::RC_Wrong_MatrikelNumber;
+
+	this->m_students.update(matrikelNumber, [&](Student& student)
+	{
+		result = isEnrolled(student, courseKey) ? RC_StudentDb_t::RC_Success
+				: RC_StudentDb_t::RC_Wrong_Course_Key;
+
+		this->accountEnrollments(student.getEnrollments(), -1, courseKey);
+
+		student.updateGrade(newGrade, courseKey);
+
+		this->accountEnrollments(student.getEnrollments(), 1, courseKey);
+	});
+
+	return result;
+}
+
+bool StudentDb::isEnrolled(const Student &student, unsigned int courseKey)
+{
+	for(const Enrollment& enrollment : student.getEnrollments())
+	{
+		if(enrollment.getcourse()->getcourseKey() == courseKey)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void StudentDb::write(std::ostream &out) const
 {
+	ShardedStudentMap::ReadView students = this->getStudents();
+
 	this->writeCoursesData(out);
-	this->writeStudentsData(out);
-	this->writeEnrollmentsData(out);
+	this->writeStudentsData(out, students);
+	this->writeEnrollmentsData(out, students);
 }
 
 void StudentDb::writeCoursesData(std::ostream &out) const
@@ -204,11 +420,12 @@ void StudentDb::writeCoursesData(std::ostream &out) const
 	}
 }
 
-void StudentDb::writeStudentsData(std::ostream &out) const
+void StudentDb::writeStudentsData(std::ostream &out,
+		const ShardedStudentMap::ReadView& students) const
 {
-	out << this->m_students.size() << endl;
+	out << students.size() << endl;
 
-	for(const pair<const int,Student>& studentsPair: this->m_students)
+	for(const pair<const int,Student>& studentsPair: students)
 	{
 		const Student& student = studentsPair.second;
 
@@ -218,11 +435,12 @@ void StudentDb::writeStudentsData(std::ostream &out) const
 	}
 }
 
-void StudentDb::writeEnrollmentsData(std::ostream &out) const
+void StudentDb::writeEnrollmentsData(std::ostream &out,
+		const ShardedStudentMap::ReadView& students) const
 {
 	map<unsigned int, vector<Enrollment>> StudentEnrollments;
 
-	for(const pair<const int,Student>& eachStudent: this->m_students)
+	for(const pair<const int,Student>& eachStudent: students)
 	{
 		unsigned int matrikelNumber = eachStudent.second.getMatrikelNumber();
 
@@ -249,18 +467,32 @@ void StudentDb::writeEnrollmentsData(std::ostream &out) const
 
 void StudentDb::read(std::istream &in)
 {
+	unique_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
 	//! Clearing the database.
 	this->m_courses.clear();
 	this->m_students.clear();
+	this->clearFingerprints();
+	this->clearCourseStatistics();
 
 	string LineStr;
 	unsigned int count = 0;
 	unsigned char caseChar;
 
+	//! The students are added in one batch, before the enrollments refer to them.
+	vector<StudentRecord> studentRecords;
+
 	while(getline(in, LineStr))
 	{
 		if(LineStr.find(";") == string::npos)
 		{
+			if(!studentRecords.empty())
+			{
+				this->insertStudentRecords(move(studentRecords));
+
+				studentRecords.clear();
+			}
+
 			if(count == 0)
 			{
 				caseChar = 'C';
@@ -286,7 +518,7 @@ void StudentDb::read(std::istream &in)
 			break;
 			case 'S':
 			{
-				this->readStudentsData(LineStr);
+				this->readStudentsData(LineStr, studentRecords);
 			}
 			break;
 			case 'E':
@@ -301,6 +533,8 @@ void StudentDb::read(std::istream &in)
 			}
 		}
 	}
+
+	this->insertStudentRecords(move(studentRecords));
 }
 
 void StudentDb::readCoursesData(std::string &str)
@@ -315,40 +549,46 @@ void StudentDb::readCoursesData(std::string &str)
 	}
 }
 
-void StudentDb::readStudentsData(std::string &str)
+void StudentDb::readStudentsData(std::string &str, std::vector<StudentRecord>& records)
 {
-	istringstream iss(str);
+	auto studentValues = readFieldsText(str, studentFields());
+	auto addressValues = readFieldsText(str, addressFields());
+
+	StudentRecord record;
 
-	Student readStudent = Student::read(iss);
+	tie(record.matrikelNumber, record.firstName, record.lastName, record.dateOfBirth) =
+			move(studentValues);
+	tie(record.street, record.postalCode, record.cityName, record.additionalInfo) =
+			move(addressValues);
 
-	this->m_students.insert(make_pair(readStudent.getMatrikelNumber(), readStudent));
+	records.push_back(move(record));
 }
 
 void StudentDb::readEnrollmentData(std::string &str)
 {
 	unsigned int matrikelNumber = stoul(splitAt(str, ';'));
 
-	for(const pair<const int, unique_ptr<const Course>>& pairItr : this->m_courses)
+	istringstream iss(str);
+
+	//! The course is looked up once, so the student gets a single new version.
+	Enrollment readEnrollment = Enrollment::read(iss, this->m_courses);
+
+	if(readEnrollment.getcourse() == nullptr)
 	{
-		const Course& courseref =  *(pairItr.second.get());
+		return;
+	}
 
-		map<int, Student>::iterator checkMatrikel = this->m_students.find(matrikelNumber);
+	unsigned int courseKey = readEnrollment.getcourse()->getcourseKey();
 
-		if(checkMatrikel->second.getMatrikelNumber() == matrikelNumber)
-		{
-			istringstream iss(str);
+	this->m_students.update(matrikelNumber, [&](Student& student)
+	{
+		this->accountEnrollments(student.getEnrollments(), -1, courseKey);
 
-			Enrollment readEnrollment = Enrollment::read(iss, &courseref);
+		student.addEnrollment(readEnrollment.getsemester(), readEnrollment.getcourse());
+		student.updateGrade(readEnrollment.getgrade(), courseKey);
 
-			if(readEnrollment.getcourse() != nullptr)
-			{
-				checkMatrikel->second.addEnrollment(readEnrollment.getsemester(),
-						readEnrollment.getcourse());
-				checkMatrikel->second.updateGrade(readEnrollment.getgrade(),
-						readEnrollment.getcourse()->getcourseKey());
-			}
-		}
-	}
+		this->accountEnrollments(student.getEnrollments(), 1, courseKey);
+	});
 }
 
 //void StudentDb::readStudentDataFromServer(unsigned int noOfUserData)
@@ -448,15 +688,22 @@ bool StudentDb::isValidServerDataString(const std::string &eachStr)
 	}
 }
 
-void StudentDb::readStudentDataFromServer(unsigned int noOfUserData)
+void StudentDb::readStudentDataFromServer(unsigned int noOfUserData,
+		std::ostream &report)
 {
 	//! Create a socket address
-	Poco::Net::SocketAddress socketAddress("www.hhs.users.h-da.cloud", 4242);
+	Poco::Net::SocketAddress socketAddress(this->m_serverHost, this->m_serverPort);
 
 	string readLine;
 
 	unsigned int loopIdx = 0;
 
+	vector<StudentRecord> records;
+
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
+
+	this->m_ingestionMetrics.start("connection per record", noOfUserData);
+
 	while(loopIdx < noOfUserData)
 	{
 		//! Create a stream socket
@@ -464,11 +711,20 @@ void StudentDb::readStudentDataFromServer(unsigned int noOfUserData)
 
 		try
 		{
+			chrono::steady_clock::time_point connectStart = chrono::steady_clock::now();
+
 			socket.connect(socketAddress, Poco::Timespan(5, 0));
 
+			chrono::steady_clock::time_point requestStart = chrono::steady_clock::now();
+
+			this->m_ingestionMetrics.recordConnect(requestStart - connectStart);
+
 			//! Create a SocketStream using the socket
 			Poco::Net::SocketStream stream(socket);
 
+			//! Timeouts of the socket are thrown instead of ending the stream.
+			stream.exceptions(ios::badbit);
+
 			stream << "generate";
 			stream.flush();
 
@@ -482,109 +738,1571 @@ void StudentDb::readStudentDataFromServer(unsigned int noOfUserData)
 				serverData.push_back(readLine);
 			}
 
+			this->m_ingestionMetrics.recordRequest(chrono::steady_clock::now() - requestStart);
+
 			//! Calling shutdownReceive() indicates that you will no longer be receiving data on the socket.
+			//! No "quit" follows, the sending side is already shut down.
 			socket.shutdownReceive();
 
-			stream << "quit";
-			stream.flush();
-
 			//! the socket is no longer in use
 			socket.close();
 
 			if(serverData.empty() == false)
 			{
-				cout << serverData.at(0) << endl; // this prints 100 Generating
+				report << serverData.at(0) << endl; // this prints 100 Generating
 
-				cout << loopIdx+1 << " User Data\n" << endl;
+				report << loopIdx+1 << " User Data\n" << endl;
 
-				parsingJSONData(serverData.at(1));	//! This line contains the JSON Data required.
+				StudentRecord record;
+
+				//! This line contains the JSON Data required.
+				if(parsingJSONData(serverData.at(1), record))
+				{
+					records.push_back(move(record));
+				}
 
-				cout << serverData.at(2) << endl;
+				report << serverData.at(2) << endl;
 			}
 		}
 		catch(const Poco::Exception& e)
 		{
-			cerr << "Exception caught: " << e.displayText() << endl;
+			this->m_ingestionMetrics.countError(e);
+
+			report << "Exception caught: " << e.displayText() << endl;
+		}
+		catch(const exception& e)
+		{
+			this->m_ingestionMetrics.countError(e);
+
+			report << "Exception caught: " << e.what() << endl;
 		}
 
 		loopIdx++;	
 	}
+
+	this->insertServerRecords(move(records));
+
+	this->m_ingestionMetrics.finish();
+	this->m_ingestionMetrics.writeSummary(report);
 }
 
-void StudentDb::parsingJSONData(std::string &JSONData)
+unsigned int StudentDb::readStudentDataFromServerPipelined(unsigned int noOfUserData,
+		std::ostream &report,
+		unsigned int pipelineDepth)
 {
-	Poco::JSON::Parser jsonParser;
+	Poco::Net::SocketAddress socketAddress(this->m_serverHost, this->m_serverPort);
 
-	Poco::Dynamic::Var parsedJSONData = jsonParser.parse(JSONData);
+	unsigned int requested = 0;
+	unsigned int inFlight = 0;
 
-	Poco::JSON::Object::Ptr jsonObjectPtr = parsedJSONData.extract<Poco::JSON::Object::Ptr>();
+	vector<StudentRecord> records;
 
-	Poco::DynamicStruct JSONDataStruct = *jsonObjectPtr;
+	records.reserve(noOfUserData);
 
-	if(this->isValidServerDataString(JSONDataStruct["name"]["firstName"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["name"]["lastName"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["dateOfBirth"]["year"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["dateOfBirth"]["month"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["dateOfBirth"]["date"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["location"]["street"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["location"]["postCode"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["location"]["city"].toString()) &&
-			this->isValidServerDataString(JSONDataStruct["location"]["state"].toString()))
-	{
-		string firstName = Poco::UTF8::unescape(JSONDataStruct["name"]["firstName"].toString());
-		string lastName = Poco::UTF8::unescape(JSONDataStruct["name"]["lastName"].toString());
-		int year = JSONDataStruct["dateOfBirth"]["year"].convert<int>()+1900;
-		int month = JSONDataStruct["dateOfBirth"]["month"].convert<int>()+1;
-		int day = JSONDataStruct["dateOfBirth"]["date"].convert<int>();
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
 
-		string streetName = Poco::UTF8::unescape(JSONDataStruct["location"]["street"].toString());
-		int postalCode = JSONDataStruct["location"]["postCode"].convert<int>();
-		string cityName = Poco::UTF8::unescape(JSONDataStruct["location"]["city"].toString());
-		string additionalInfo = Poco::UTF8::unescape(JSONDataStruct["location"]["state"].toString());
+	this->m_ingestionMetrics.start("pipelined, depth " + to_string(pipelineDepth), noOfUserData);
 
-		shared_ptr<Address> address =
-				make_shared<Address>(streetName, postalCode, cityName, additionalInfo);
+	try
+	{
+		exchangeServerRequests(socketAddress, pipelineDepth,
+				[&requested, noOfUserData](bool)
+				{
+					return (requested < noOfUserData) ? (requested++, true) : false;
+				},
+				[this, &records](string& jsonLine)
+				{
+					StudentRecord record;
+
+					if(this->parsingJSONData(jsonLine, record))
+					{
+						records.push_back(move(record));
+					}
+				},
+				inFlight, this->m_ingestionMetrics);
+	}
+	catch(const Poco::Exception& e)
+	{
+		this->m_ingestionMetrics.countError(e);
 
-		Student student = Student(firstName, lastName, Poco::Data::Date(year, month, day), address);
+		report << "Exception caught: " << e.displayText() << endl;
+	}
+	catch(const exception& e)
+	{
+		this->m_ingestionMetrics.countError(e);
 
-		this->m_students.insert(make_pair(student.getMatrikelNumber(), student));
+		report << "Exception caught: " << e.what() << endl;
 	}
+
+	unsigned int received = requested - inFlight;
+
+	unsigned int inserted = this->insertServerRecords(move(records));
+
+	report << received << " of " << noOfUserData << " User Data read, "
+			<< inserted << " added" << endl;
+
+	this->m_ingestionMetrics.finish();
+	this->m_ingestionMetrics.writeSummary(report);
+
+	return received;
 }
 
-Poco::JSON::Object::Ptr StudentDb::toJson() const
+unsigned int StudentDb::readStudentDataFromServerParallel(unsigned int noOfUserData,
+		std::ostream &report,
+		unsigned int noOfConnections, unsigned int pipelineDepth)
 {
-	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
+	Poco::Net::SocketAddress socketAddress(this->m_serverHost, this->m_serverPort);
 
-	Poco::JSON::Array::Ptr coursesArray = new Poco::JSON::Array;
+	noOfConnections = max(noOfConnections, 1u);
 
-	for(const pair<const int, unique_ptr<const Course>>& course: this->m_courses)
+	//! Requests not yet claimed by a connection.
+	atomic<unsigned int> unclaimed(noOfUserData);
+
+	//! Requests without a response, claimed or not.
+	atomic<unsigned int> unanswered(noOfUserData);
+
+	atomic<unsigned int> activeWorkers(noOfConnections);
+
+	//! Signalled when requests are released or all are answered.
+	mutex requestsMutex;
+	condition_variable requestsChanged;
+
+	auto notifyRequestsChanged = [&requestsMutex, &requestsChanged]()
 	{
-		coursesArray->add(course.second->toJson());
+		//! Taking the lock orders the change before the waiter's check.
+		lock_guard<mutex> requestsLock(requestsMutex);
+
+		requestsChanged.notify_all();
+	};
+
+	BoundedQueue<StudentRecord> records(noOfConnections * pipelineDepth * 4);
+
+	vector<unsigned int> connectionReceived(noOfConnections, 0);
+	vector<unsigned int> connectionRejected(noOfConnections, 0);
+	vector<string> connectionErrors(noOfConnections);
+
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
+
+	this->m_ingestionMetrics.start("parallel, " + to_string(noOfConnections)
+			+ " connections", noOfUserData);
+
+	auto claimRequest = [&](bool mayWait)
+	{
+		while(true)
+		{
+			unsigned int available = unclaimed.load();
+
+			while(available > 0)
+			{
+				if(unclaimed.compare_exchange_weak(available, available - 1))
+				{
+					return true;
+				}
+			}
+
+			if(!mayWait)
+			{
+				return false;
+			}
+
+			//! Requests released by a failed connection may still show up.
+			unique_lock<mutex> requestsLock(requestsMutex);
+
+			requestsChanged.wait(requestsLock, [&unclaimed, &unanswered]()
+					{ return unclaimed.load() > 0 || unanswered.load() == 0; });
+
+			if(unclaimed.load() == 0)
+			{
+				return false;
+			}
+		}
+	};
+
+	vector<thread> workers;
+
+	for(unsigned int connIdx = 0; connIdx < noOfConnections; connIdx++)
+	{
+		workers.emplace_back([&, connIdx]()
+		{
+			unsigned int inFlight = 0;
+
+			try
+			{
+				exchangeServerRequests(socketAddress, pipelineDepth, claimRequest,
+						[&](string& jsonLine)
+						{
+							StudentRecord record;
+
+							if(--unanswered == 0)
+							{
+								notifyRequestsChanged();
+							}
+
+							connectionReceived[connIdx]++;
+
+							if(this->m_ingestionMetrics.scanRecord(jsonLine, record))
+							{
+								records.push(move(record));
+							}
+							else
+							{
+								connectionRejected[connIdx]++;
+							}
+						},
+						inFlight, this->m_ingestionMetrics);
+			}
+			catch(const Poco::Exception& e)
+			{
+				this->m_ingestionMetrics.countError(e);
+
+				connectionErrors[connIdx] = e.displayText();
+			}
+			catch(const exception& e)
+			{
+				this->m_ingestionMetrics.countError(e);
+
+				connectionErrors[connIdx] = e.what();
+			}
+
+			//! Hand the unanswered requests over to the other connections.
+			if(inFlight > 0)
+			{
+				unclaimed += inFlight;
+
+				notifyRequestsChanged();
+			}
+
+			if(--activeWorkers == 0)
+			{
+				records.close();
+			}
+		});
 	}
 
-	Poco::JSON::Array::Ptr studentsArray = new Poco::JSON::Array;
+	unsigned int inserted = 0;
 
-	for(const pair<const int,Student>& student: this->m_students)
+	vector<StudentRecord> batch;
+
+	while(records.popAll(batch))
 	{
-		studentsArray->add(student.second.toJson());
+		inserted += this->insertServerRecords(move(batch));
+
+		batch.clear();
 	}
 
-	returnObj->set("courses", coursesArray);
-	returnObj->set("students", studentsArray);
+	for(thread& worker : workers)
+	{
+		worker.join();
+	}
 
-	return returnObj;
+	for(unsigned int connIdx = 0; connIdx < noOfConnections; connIdx++)
+	{
+		report << "Connection " << connIdx + 1 << ": " << connectionReceived[connIdx]
+			<< " received, " << connectionRejected[connIdx] << " rejected" << endl;
+
+		if(!connectionErrors[connIdx].empty())
+		{
+			report << "Connection " << connIdx + 1 << " failed: " << connectionErrors[connIdx] << endl;
+		}
+	}
+
+	report << inserted << " of " << noOfUserData << " User Data added, "
+			<< unanswered.load() << " not received" << endl;
+
+	this->m_ingestionMetrics.finish();
+	this->m_ingestionMetrics.writeSummary(report);
+
+	return inserted;
 }
 
-void StudentDb::fromJson(Poco::JSON::Object::Ptr data)
+unsigned int StudentDb::readStudentDataFromServerAsync(unsigned int noOfUserData,
+		std::ostream &report,
+		unsigned int noOfConnections, unsigned int pipelineDepth,
+		unsigned int noOfThreads)
 {
-	Poco::JSON::Array::Ptr studentArray = data->getArray("students");
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
 
-	for(const Poco::Dynamic::Var& studentData: *studentArray)
+	this->m_ingestionMetrics.start("asynchronous, " + to_string(noOfConnections)
+			+ " connections", noOfUserData);
+
+	AsyncServerIngestion ingestion(this->m_serverHost, to_string(this->m_serverPort),
+			noOfConnections, pipelineDepth, noOfThreads, this->m_ingestionMetrics);
+
+	unsigned int inserted = 0;
+
+	try
 	{
-		Poco::JSON::Object::Ptr dataPtr = studentData.extract<Poco::JSON::Object::Ptr>();
+		inserted = ingestion.run(noOfUserData,
+				[this](vector<StudentRecord> batch){ return this->insertServerRecords(move(batch)); },
+				report);
+	}
+	catch(const exception& e)
+	{
+		this->m_ingestionMetrics.countError(e);
+
+		report << "Exception caught: " << e.what() << endl;
+	}
+
+	this->m_ingestionMetrics.finish();
+	this->m_ingestionMetrics.writeSummary(report);
+
+	return inserted;
+}
+
+unsigned int StudentDb::readStudentDataFromServerStaged(unsigned int noOfUserData,
+		std::ostream &report,
+		unsigned int pipelineDepth, unsigned int ringCapacity)
+{
+	Poco::Net::SocketAddress socketAddress(this->m_serverHost, this->m_serverPort);
 
-		Student addStudent = Student::fromJson(dataPtr);
+	SpscRing<string> jsonLines(ringCapacity);
+	SpscRing<Poco::JSON::Object::Ptr> parsedData(ringCapacity);
+	SpscRing<StudentRecord> records(ringCapacity);
 
-		this->m_students.insert(make_pair(addStudent.getMatrikelNumber(), addStudent));
+	unsigned int requested = 0;
+	unsigned int inFlight = 0;
+	unsigned int malformed = 0;
+	unsigned int rejected = 0;
+
+	string fetchError;
+
+	lock_guard<mutex> ingestionLock(this->m_ingestionMutex);
+
+	IngestionMetrics& metrics = this->m_ingestionMetrics;
+
+	metrics.start("staged pipeline", noOfUserData);
+
+	thread fetchStage([&]()
+	{
+		try
+		{
+			exchangeServerRequests(socketAddress, pipelineDepth,
+					[&requested, noOfUserData](bool)
+					{
+						return (requested < noOfUserData) ? (requested++, true) : false;
+					},
+					[&jsonLines](string& jsonLine)
+					{
+						jsonLines.push(move(jsonLine));
+					},
+					inFlight, metrics);
+		}
+		catch(const Poco::Exception& e)
+		{
+			metrics.countError(e);
+
+			fetchError = e.displayText();
+		}
+		catch(const exception& e)
+		{
+			metrics.countError(e);
+
+			fetchError = e.what();
+		}
+
+		jsonLines.close();
+	});
+
+	thread parseStage([&]()
+	{
+		Poco::JSON::Parser parser;
+
+		string jsonLine;
+
+		while(jsonLines.pop(jsonLine))
+		{
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+			Poco::JSON::Object::Ptr serverData;
+
+			try
+			{
+				parser.reset();
+
+				Poco::Dynamic::Var parsedJSONData = parser.parse(jsonLine);
+
+				serverData = parsedJSONData.extract<Poco::JSON::Object::Ptr>();
+			}
+			catch(const Poco::Exception&)
+			{
+				malformed++;
+			}
+
+			metrics.recordParse(chrono::steady_clock::now() - start);
+			metrics.countReceived();
+
+			if(serverData.isNull())
+			{
+				metrics.countMalformed();
+			}
+			else
+			{
+				parsedData.push(serverData);
+			}
+		}
+
+		parsedData.close();
+	});
+
+	thread extractStage([&]()
+	{
+		Poco::JSON::Object::Ptr serverData;
+
+		while(parsedData.pop(serverData))
+		{
+			StudentRecord record;
+
+			bool isValid = false;
+
+			try
+			{
+				isValid = extractServerRecord(*serverData, record);
+			}
+			catch(const Poco::Exception&)
+			{
+				//! E.g. a group that is no object or a postCode that is no number.
+			}
+			catch(const exception&)
+			{
+			}
+
+			if(isValid)
+			{
+				metrics.countValid();
+
+				records.push(move(record));
+			}
+			else
+			{
+				metrics.countRejected();
+
+				rejected++;
+			}
+		}
+
+		records.close();
+	});
+
+	//! The students are constructed here, the matrikel numbers follow the insertion order.
+	unsigned int inserted = 0;
+
+	vector<StudentRecord> batch;
+
+	StudentRecord record;
+
+	while(records.pop(record))
+	{
+		batch.push_back(move(record));
+
+		//! Take whatever is ready, a batch never waits for more records.
+		while(batch.size() < ringCapacity && records.tryPop(record))
+		{
+			batch.push_back(move(record));
+		}
+
+		inserted += this->insertServerRecords(move(batch));
+
+		batch.clear();
+	}
+
+	fetchStage.join();
+	parseStage.join();
+	extractStage.join();
+
+	if(!fetchError.empty())
+	{
+		report << "Exception caught: " << fetchError << endl;
+	}
+
+	report << requested - inFlight << " of " << noOfUserData << " User Data read, "
+			<< malformed << " malformed, " << rejected << " rejected, "
+			<< inserted << " added" << endl;
+
+	metrics.finish();
+	metrics.writeSummary(report);
+
+	return inserted;
+}
+
+void StudentDb::exchangeServerRequests(const Poco::Net::SocketAddress &address,
+		unsigned int pipelineDepth, const std::function<bool(bool)> &claimRequest,
+		const std::function<void(std::string&)> &onResponse, unsigned int &inFlight,
+		IngestionMetrics &metrics)
+{
+	Poco::Net::StreamSocket socket;
+
+	chrono::steady_clock::time_point connectStart = chrono::steady_clock::now();
+
+	socket.connect(address, Poco::Timespan(5, 0));
+	socket.setReceiveTimeout(Poco::Timespan(10, 0));
+
+	metrics.recordConnect(chrono::steady_clock::now() - connectStart);
+
+	Poco::Net::SocketStream stream(socket);
+
+	//! Timeouts of the socket are thrown instead of ending the stream.
+	stream.exceptions(ios::badbit);
+
+	string jsonLine;
+
+	//! Send times of the requests in flight, the responses come in order.
+	deque<chrono::steady_clock::time_point> sentAt;
+
+	pipelineDepth = max(pipelineDepth, 1u);
+
+	while(true)
+	{
+		//! Refill the pipeline, the requests go out with one flush.
+		while(inFlight < pipelineDepth && claimRequest(inFlight == 0))
+		{
+			stream << "generate\n";
+			inFlight++;
+
+			sentAt.push_back(chrono::steady_clock::now());
+		}
+
+		if(inFlight == 0)
+		{
+			break;
+		}
+
+		stream.flush();
+
+		if(!readServerResponse(stream, jsonLine))
+		{
+			throw Poco::IOException("Connection closed by the server");
+		}
+
+		inFlight--;
+
+		metrics.recordRequest(chrono::steady_clock::now() - sentAt.front());
+
+		sentAt.pop_front();
+
+		onResponse(jsonLine);
+	}
+
+	stream << "quit\n";
+	stream.flush();
+
+	socket.shutdownSend();
+	socket.close();
+}
+
+bool StudentDb::readServerResponse(std::istream &in, std::string &jsonLine)
+{
+	string statusLine;
+
+	if(!getline(in, statusLine) || !getline(in, jsonLine) || !getline(in, statusLine))
+	{
+		return false;
+	}
+
+	if(!jsonLine.empty() && jsonLine.back() == '\r')
+	{
+		jsonLine.pop_back();
+	}
+
+	return true;
+}
+
+bool StudentDb::parsingJSONData(std::string &JSONData, StudentRecord &record)
+{
+	return this->m_ingestionMetrics.scanRecord(JSONData, record);
+}
+
+unsigned int StudentDb::replayServerData(std::istream &in, std::ostream &report)
+{
+	Poco::JSON::Parser parser;
+
+	string line;
+
+	unsigned int noOfResponses = 0;
+	unsigned int malformed = 0;
+	unsigned int inserted = 0;
+
+	chrono::nanoseconds parseTime(0), extractTime(0), insertTime(0);
+
+	vector<StudentRecord> records;
+
+	while(getline(in, line))
+	{
+		if(!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		//! Status lines like "100 Generating" carry no student data.
+		if(line.empty() || line.front() != '{')
+		{
+			continue;
+		}
+
+		noOfResponses++;
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+		Poco::Dynamic::Var parsedJSONData;
+
+		try
+		{
+			parser.reset();
+
+			parsedJSONData = parser.parse(line);
+		}
+		catch(const Poco::Exception&)
+		{
+			malformed++;
+		}
+
+		chrono::steady_clock::time_point parsed = chrono::steady_clock::now();
+
+		parseTime += parsed - start;
+
+		if(parsedJSONData.isEmpty())
+		{
+			continue;
+		}
+
+		StudentRecord record;
+
+		bool isValid = false;
+
+		//! A record that cannot be extracted counts as rejected.
+		try
+		{
+			isValid = StudentDb::extractServerRecord(
+					*(parsedJSONData.extract<Poco::JSON::Object::Ptr>()), record);
+		}
+		catch(const Poco::Exception&)
+		{
+		}
+		catch(const exception&)
+		{
+		}
+
+		chrono::steady_clock::time_point extracted = chrono::steady_clock::now();
+
+		extractTime += extracted - parsed;
+
+		if(isValid)
+		{
+			records.push_back(move(record));
+		}
+	}
+
+	unsigned int noOfValid = records.size();
+
+	chrono::steady_clock::time_point insertStart = chrono::steady_clock::now();
+
+	inserted = this->addStudentsBatch(move(records));
+
+	insertTime = chrono::steady_clock::now() - insertStart;
+
+	auto perResponse = [noOfResponses](chrono::nanoseconds time)
+	{
+		return static_cast<double>(time.count()) / max(noOfResponses, 1u);
+	};
+
+	report << noOfResponses << " responses replayed, " << inserted << " added, "
+			<< noOfValid - inserted << " duplicates, "
+			<< noOfResponses - noOfValid - malformed << " rejected, "
+			<< malformed << " malformed" << endl;
+	ios::fmtflags flags = report.flags();
+	streamsize precision = report.precision();
+
+	report << fixed << setprecision(1)
+			<< "\t parse: " << perResponse(parseTime) << " ns/response, "
+			<< "extract and validate: " << perResponse(extractTime) << " ns/response, "
+			<< "insert: " << perResponse(insertTime) << " ns/response" << endl;
+	report.flags(flags);
+	report.precision(precision);
+
+	return inserted;
+}
+
+bool StudentDb::extractServerRecord(const Poco::JSON::Object &data,
+		StudentRecord &record)
+{
+	int year = 0, month = 0, day = 0, postalCode = 0;
+
+	unsigned int fieldsRead = 0;
+
+	//! Reads a string field, validates and unescapes it exactly once.
+	auto readServerString = [&fieldsRead](const Poco::Dynamic::Var& value,
+			std::string& target)
+	{
+		readJsonValue(value, target);
+
+		if(!StudentDb::isValidServerDataString(target))
+		{
+			return false;
+		}
+
+		target = Poco::UTF8::unescape(target);
+
+		fieldsRead++;
+
+		return true;
+	};
+
+	for(const Poco::JSON::Object::ValueType& group : data)
+	{
+		const string& groupKey = group.first;
+
+		if(groupKey != "name" && groupKey != "dateOfBirth" && groupKey != "location")
+		{
+			continue;
+		}
+
+		for(const Poco::JSON::Object::ValueType& field : jsonObjectValue(group.second))
+		{
+			const string& key = field.first;
+
+			bool isValid = true;
+
+			if(groupKey == "name")
+			{
+				if(key == "firstName")
+				{
+					isValid = readServerString(field.second, record.firstName);
+				}
+				else if(key == "lastName")
+				{
+					isValid = readServerString(field.second, record.lastName);
+				}
+			}
+			else if(groupKey == "dateOfBirth")
+			{
+				if(key == "year")
+				{
+					readJsonValue(field.second, year);
+					fieldsRead++;
+				}
+				else if(key == "month")
+				{
+					readJsonValue(field.second, month);
+					fieldsRead++;
+				}
+				else if(key == "date")
+				{
+					readJsonValue(field.second, day);
+					fieldsRead++;
+				}
+			}
+			else
+			{
+				if(key == "street")
+				{
+					isValid = readServerString(field.second, record.street);
+				}
+				else if(key == "postCode")
+				{
+					readJsonValue(field.second, postalCode);
+					fieldsRead++;
+				}
+				else if(key == "city")
+				{
+					isValid = readServerString(field.second, record.cityName);
+				}
+				else if(key == "state")
+				{
+					isValid = readServerString(field.second, record.additionalInfo);
+				}
+			}
+
+			if(!isValid)
+			{
+				return false;
+			}
+		}
+	}
+
+	if(fieldsRead < 9 || !Poco::DateTime::isValid(year+1900, month+1, day))
+	{
+		return false;
+	}
+
+	record.dateOfBirth = Poco::Data::Date(year+1900, month+1, day);
+	record.postalCode = postalCode;
+
+	return true;
+}
+
+Poco::JSON::Object::Ptr StudentDb::toJson() const
+{
+	return this->toJson(this->getStudents());
+}
+
+Poco::JSON::Object::Ptr StudentDb::toJson(const ShardedStudentMap::ReadView& students) const
+{
+	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
+
+	Poco::JSON::Array::Ptr coursesArray = new Poco::JSON::Array;
+
+	for(const pair<const int, unique_ptr<const Course>>& course: this->m_courses)
+	{
+		coursesArray->add(course.second->toJson());
+	}
+
+	Poco::JSON::Array::Ptr studentsArray = new Poco::JSON::Array;
+
+	for(const pair<const int,Student>& student: students)
+	{
+		studentsArray->add(student.second.toJson());
+	}
+
+	returnObj->set("courses", coursesArray);
+	returnObj->set("students", studentsArray);
+
+	return returnObj;
+}
+
+void StudentDb::fromJson(Poco::JSON::Object::Ptr data)
+{
+	Poco::JSON::Array::Ptr studentArray = data->getArray("students");
+
+	vector<StudentRecord> records;
+
+	records.reserve(studentArray->size());
+
+	for(const Poco::Dynamic::Var& studentData: *studentArray)
+	{
+		Poco::JSON::Object::Ptr dataPtr = studentData.extract<Poco::JSON::Object::Ptr>();
+
+		Poco::JSON::Object::Ptr addressData = dataPtr->getObject("address");
+
+		if(addressData.isNull())
+		{
+			throw Poco::NotFoundException("Incomplete student JSON data");
+		}
+
+		StudentRecord record;
+
+		tie(record.matrikelNumber, record.firstName, record.lastName, record.dateOfBirth) =
+				readFieldsJson(*dataPtr, studentFields());
+		tie(record.street, record.postalCode, record.cityName, record.additionalInfo) =
+				readFieldsJson(*addressData, addressFields());
+
+		Poco::JSON::Array::Ptr enrollmentArray = dataPtr->getArray("enrollments");
+
+		if(!enrollmentArray.isNull())
+		{
+			for(const Poco::Dynamic::Var& enrollmentData: *enrollmentArray)
+			{
+				EnrollmentRecord enrollment;
+
+				tie(enrollment.courseKey, enrollment.semester, enrollment.grade) =
+						readFieldsJson(*(enrollmentData.extract<Poco::JSON::Object::Ptr>()),
+								enrollmentFields());
+
+				record.enrollments.push_back(move(enrollment));
+			}
+		}
+
+		records.push_back(move(record));
+	}
+
+	this->addStudentsBatch(move(records));
+}
+
+
+void StudentDb::writeJson(std::ostream &out, unsigned int noOfThreads) const
+{
+	const unsigned int indent = 2;
+
+	//! More ranges than workers, so the workers finishing early steal the rest.
+	if(noOfThreads == 0)
+	{
+		noOfThreads = this->m_workers.getNoOfWorkers() * 4;
+	}
+
+	ShardedStudentMap::ReadView students = this->getStudents();
+
+	unsigned int noOfChunks = min<size_t>(noOfThreads, students.size());
+
+	if(noOfChunks < 2)
+	{
+		Poco::JSON::Stringifier::stringify(this->toJson(students), out, indent, indent);
+
+		return;
+	}
+
+	//! The document with one placeholder string per range in the students array.
+	Poco::JSON::Object::Ptr frameObj = new Poco::JSON::Object;
+
+	Poco::JSON::Array::Ptr coursesArray = new Poco::JSON::Array;
+
+	for(const pair<const int, unique_ptr<const Course>>& course: this->m_courses)
+	{
+		coursesArray->add(course.second->toJson());
+	}
+
+	Poco::JSON::Array::Ptr placeholderArray = new Poco::JSON::Array;
+
+	vector<string> placeholders;
+
+	for(unsigned int chunkIdx = 0; chunkIdx < noOfChunks; chunkIdx++)
+	{
+		placeholders.push_back("@@StudentDbRange" + to_string(chunkIdx) + "@@");
+
+		placeholderArray->add(placeholders.back());
+
+		//! Quoted, as found in the stringified document.
+		placeholders.back() = '"' + placeholders.back() + '"';
+	}
+
+	frameObj->set("courses", coursesArray);
+	frameObj->set("students", placeholderArray);
+
+	ostringstream frameStream;
+
+	Poco::JSON::Stringifier::stringify(frameObj, frameStream, indent, indent);
+
+	const string frame = frameStream.str();
+
+	vector<size_t> placeholderPos;
+
+	for(const string& placeholder : placeholders)
+	{
+		placeholderPos.push_back(frame.find(placeholder));
+	}
+
+	//! The text the array writes between two elements, and the indent of its elements.
+	const size_t firstEnd = placeholderPos[0] + placeholders[0].size();
+	const string separator = frame.substr(firstEnd, placeholderPos[1] - firstEnd);
+	const unsigned int elementIndent = placeholderPos[0] - frame.rfind('\n', placeholderPos[0]) - 1;
+
+	//! Contiguous ranges of students, the first ones get the remainder.
+	vector<ShardedStudentMap::ReadView::const_iterator> chunkBegin;
+
+	ShardedStudentMap::ReadView::const_iterator itr = students.begin();
+
+	for(unsigned int chunkIdx = 0; chunkIdx < noOfChunks; chunkIdx++)
+	{
+		chunkBegin.push_back(itr);
+
+		size_t chunkSize = students.size() / noOfChunks +
+				((chunkIdx < students.size() % noOfChunks) ? 1 : 0);
+
+		advance(itr, chunkSize);
+	}
+
+	chunkBegin.push_back(students.end());
+
+	vector<string> chunkText(noOfChunks);
+
+	this->m_workers.parallelFor(0, noOfChunks, [&](size_t firstChunk, size_t lastChunk)
+	{
+		for(size_t chunkIdx = firstChunk; chunkIdx < lastChunk; chunkIdx++)
+		{
+			ostringstream chunkStream;
+
+			for(ShardedStudentMap::ReadView::const_iterator studentItr = chunkBegin[chunkIdx];
+					studentItr != chunkBegin[chunkIdx + 1]; studentItr++)
+			{
+				if(studentItr != chunkBegin[chunkIdx])
+				{
+					chunkStream << separator;
+				}
+
+				Poco::JSON::Stringifier::stringify(studentItr->second.toJson(),
+						chunkStream, elementIndent + indent, indent);
+			}
+
+			chunkText[chunkIdx] = chunkStream.str();
+		}
+	}, 1);
+
+	size_t framePos = 0;
+
+	for(unsigned int chunkIdx = 0; chunkIdx < noOfChunks; chunkIdx++)
+	{
+		out.write(frame.data() + framePos, placeholderPos[chunkIdx] - framePos);
+		out << chunkText[chunkIdx];
+
+		framePos = placeholderPos[chunkIdx] + placeholders[chunkIdx].size();
+	}
+
+	out.write(frame.data() + framePos, frame.size() - framePos);
+}
+
+void StudentDb::readJson(std::istream &in)
+{
+	//! Records parsed before they are added to the staging database.
+	const size_t importBatchSize = 4096;
+
+	//! The document is streamed into a staging database, which replaces this
+	//! one once the parse succeeded, so malformed JSON leaves the database as
+	//! it was. Only one batch of records is held besides the staged students.
+	StudentDb staging;
+
+	vector<StudentRecord> studentRecords;
+
+	Poco::JSON::Handler::Ptr importHandler = new JsonImportHandler(
+			[&staging](unique_ptr<Course> course){ staging.insertCourse(move(course)); },
+			[&staging, &studentRecords, importBatchSize](StudentRecord record)
+			{
+				studentRecords.push_back(move(record));
+
+				if(studentRecords.size() >= importBatchSize)
+				{
+					staging.insertStudentRecords(move(studentRecords));
+
+					studentRecords.clear();
+				}
+			});
+
+	Poco::JSON::Parser parser(importHandler);
+
+	parser.parse(in);
+
+	staging.insertStudentRecords(move(studentRecords));
+
+	unique_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	//! The old courses end up in staging and are released with it,
+	//! after the lock, when no view of the old students is left.
+	this->m_students.replaceWith(staging.m_students);
+	this->m_courses.swap(staging.m_courses);
+
+	{
+		lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+		swap(this->m_studentFingerprints, staging.m_studentFingerprints);
+	}
+
+	{
+		lock_guard<mutex> statisticsLock(this->m_courseStatisticsMutex);
+
+		this->m_courseStatistics.swap(staging.m_courseStatistics);
+	}
+}
+
+void StudentDb::writeJsonLines(std::ostream &out) const
+{
+	ShardedStudentMap::ReadView students = this->getStudents();
+
+	for(const pair<const int, unique_ptr<const Course>>& course: this->m_courses)
+	{
+		Poco::JSON::Object courseLine;
+
+		courseLine.set("course", course.second->toJson());
+		courseLine.stringify(out);
+
+		out << '\n';
+	}
+
+	for(const pair<const int,Student>& student: students)
+	{
+		Poco::JSON::Object studentLine;
+
+		studentLine.set("student", student.second.toJson());
+		studentLine.stringify(out);
+
+		out << '\n';
+	}
+
+	out.flush();
+}
+
+void StudentDb::readJsonLines(std::istream &in)
+{
+	string data((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+
+	unsigned int noOfChunks = this->m_workers.getNoOfWorkers() * 4;
+
+	//! Chunk boundaries, each one moved forward behind the next line end.
+	vector<size_t> chunkStart(noOfChunks + 1, data.size());
+
+	chunkStart[0] = 0;
+
+	for(unsigned int chunkIdx = 1; chunkIdx < noOfChunks; chunkIdx++)
+	{
+		size_t pos = max(chunkStart[chunkIdx - 1], data.size() / noOfChunks * chunkIdx);
+
+		size_t lineEnd = data.find('\n', pos);
+
+		chunkStart[chunkIdx] = (lineEnd == string::npos) ? data.size() : lineEnd + 1;
+	}
+
+	vector<vector<unique_ptr<const Course>>> chunkCourses(noOfChunks);
+	vector<vector<StudentRecord>> chunkStudents(noOfChunks);
+
+	this->m_workers.parallelFor(0, noOfChunks, [&](size_t firstChunk, size_t lastChunk)
+	{
+		for(size_t chunkIdx = firstChunk; chunkIdx < lastChunk; chunkIdx++)
+		{
+			vector<unique_ptr<const Course>>& courses = chunkCourses[chunkIdx];
+			vector<StudentRecord>& students = chunkStudents[chunkIdx];
+
+			Poco::JSON::Handler::Ptr lineHandler = new JsonImportHandler(
+					[&courses](unique_ptr<Course> course){ courses.push_back(move(course)); },
+					[&students](StudentRecord record){ students.push_back(move(record)); });
+
+			Poco::JSON::Parser parser(lineHandler);
+
+			size_t lineStart = chunkStart[chunkIdx];
+
+			while(lineStart < chunkStart[chunkIdx + 1])
+			{
+				size_t lineEnd = data.find('\n', lineStart);
+
+				if(lineEnd == string::npos || lineEnd > chunkStart[chunkIdx + 1])
+				{
+					lineEnd = chunkStart[chunkIdx + 1];
+				}
+
+				string line = data.substr(lineStart, lineEnd - lineStart);
+
+				if(line.find_first_not_of(" \t\r") != string::npos)
+				{
+					parser.reset();
+					parser.parse(line);
+				}
+
+				lineStart = lineEnd + 1;
+			}
+		}
+	}, 1);
+
+	unique_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	//! Clearing the database.
+	this->m_courses.clear();
+	this->m_students.clear();
+	this->clearFingerprints();
+	this->clearCourseStatistics();
+
+	for(vector<unique_ptr<const Course>>& courses : chunkCourses)
+	{
+		for(unique_ptr<const Course>& course : courses)
+		{
+			this->insertCourse(move(course));
+		}
+	}
+
+	vector<StudentRecord> studentRecords;
+
+	for(vector<StudentRecord>& students : chunkStudents)
+	{
+		move(students.begin(), students.end(), back_inserter(studentRecords));
+	}
+
+	this->insertStudentRecords(move(studentRecords));
+}
+
+void StudentDb::insertCourse(std::unique_ptr<const Course> course)
+{
+	int courseKey = course->getcourseKey();
+
+	this->m_courses[courseKey] = move(course);
+}
+
+std::uint64_t StudentDb::studentFingerprint(const std::string &firstName,
+		const std::string &lastName, const std::string &street,
+		unsigned short postalCode, const std::string &cityName,
+		const std::string &additionalInfo)
+{
+	//! FNV-1a over the normalized fields, each followed by a separator.
+	uint64_t hash = 14695981039346656037ull;
+
+	auto addField = [&hash](const string& field)
+	{
+		string::const_iterator first = field.begin(), last = field.end();
+
+		while(first != last && ::isspace(static_cast<unsigned char>(*first)))
+		{
+			first++;
+		}
+
+		while(last != first && ::isspace(static_cast<unsigned char>(*(last - 1))))
+		{
+			last--;
+		}
+
+		for(; first != last; first++)
+		{
+			hash = (hash ^ static_cast<unsigned char>(::tolower(static_cast<unsigned char>(*first))))
+					* 1099511628211ull;
+		}
+
+		hash = (hash ^ 0x1f) * 1099511628211ull;
+	};
+
+	addField(firstName);
+	addField(lastName);
+	addField(street);
+	addField(to_string(postalCode));
+	addField(cityName);
+	addField(additionalInfo);
+
+	//! Mixes the high bits into the low bits, which select the slot.
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+
+	return hash;
+}
+
+void StudentDb::clearFingerprints()
+{
+	lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+	this->m_studentFingerprints.clear();
+}
+
+void StudentDb::accountEnrollments(const std::vector<Enrollment> &enrollments,
+		int sign, int courseKey)
+{
+	lock_guard<mutex> statisticsLock(this->m_courseStatisticsMutex);
+
+	for(const Enrollment& enrollment : enrollments)
+	{
+		int enrollmentCourseKey = enrollment.getcourse()->getcourseKey();
+
+		if(courseKey != -1 && enrollmentCourseKey != courseKey)
+		{
+			continue;
+		}
+
+		CourseStatistics& statistics = this->m_courseStatistics[enrollmentCourseKey];
+
+		if(sign > 0)
+		{
+			statistics.addEnrollment(enrollment.getgrade());
+		}
+		else
+		{
+			statistics.removeEnrollment(enrollment.getgrade());
+		}
+	}
+}
+
+void StudentDb::clearCourseStatistics()
+{
+	lock_guard<mutex> statisticsLock(this->m_courseStatisticsMutex);
+
+	this->m_courseStatistics.clear();
+}
+
+std::uint64_t StudentDb::studentFingerprint(const Student &student)
+{
+	const Address& address = *student.getAddress();
+
+	return studentFingerprint(student.getFirstName(), student.getLastName(),
+			address.getstreet(), address.getpostalCode(), address.getcityName(),
+			address.getadditionalInfo());
+}
+
+unsigned int StudentDb::insertServerRecords(std::vector<StudentRecord> records)
+{
+	unsigned int noOfRecords = records.size();
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	unsigned int inserted = this->addStudentsBatch(move(records));
+
+	this->m_ingestionMetrics.recordInsert(noOfRecords, inserted,
+			chrono::steady_clock::now() - start);
+
+	return inserted;
+}
+
+unsigned int StudentDb::addStudentsBatch(std::vector<StudentRecord> records)
+{
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	return this->insertStudentRecords(move(records));
+}
+
+unsigned int StudentDb::addStudentsBatch(std::vector<StudentRecord> records,
+		std::vector<unsigned int> &matrikelNumbers)
+{
+	shared_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	return this->insertStudentRecords(move(records), &matrikelNumbers);
+}
+
+unsigned int StudentDb::insertStudentRecords(std::vector<StudentRecord> records,
+		std::vector<unsigned int>* matrikelNumbers)
+{
+	if(matrikelNumbers != nullptr)
+	{
+		matrikelNumbers->assign(records.size(), 0);
+	}
+
+	if(records.empty())
+	{
+		return 0;
+	}
+
+	{
+		lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+		this->m_studentFingerprints.reserve(this->m_students.size() + records.size());
+	}
+
+	unsigned int inserted = 0;
+
+	//! The duplicates are sorted out first, so exactly the numbers of the new
+	//! students are reserved.
+	vector<uint64_t> fingerprints(records.size());
+	vector<bool> isDuplicate(records.size(), false);
+
+	unsigned int noOfNewNumbers = 0;
+
+	for(size_t recordIdx = 0; recordIdx < records.size(); recordIdx++)
+	{
+		const StudentRecord& record = records[recordIdx];
+
+		fingerprints[recordIdx] = studentFingerprint(record.firstName, record.lastName,
+				record.street, record.postalCode, record.cityName, record.additionalInfo);
+
+		if(record.matrikelNumber != 0)
+		{
+			//! The insertion into the shard decides, below, if the number is taken.
+			isDuplicate[recordIdx] = this->m_students.contains(record.matrikelNumber);
+		}
+		else
+		{
+			//! Records without matrikel number are identified by their content,
+			//! checked and taken at once, so two threads cannot add the same student.
+			lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+			if(this->m_studentFingerprints.contains(fingerprints[recordIdx]))
+			{
+				isDuplicate[recordIdx] = true;
+			}
+			else
+			{
+				this->m_studentFingerprints.insert(fingerprints[recordIdx]);
+
+				noOfNewNumbers++;
+			}
+		}
+	}
+
+	//! New students take their numbers from one reserved range, without
+	//! contending for the shared counter with other loaders.
+	MatrikelAllocator::Block matrikelBlock(Student::getMatrikelAllocator(), noOfNewNumbers);
+
+	for(size_t recordIdx = 0; recordIdx < records.size(); recordIdx++)
+	{
+		if(isDuplicate[recordIdx])
+		{
+			continue;
+		}
+
+		StudentRecord& record = records[recordIdx];
+
+		uint64_t fingerprint = fingerprints[recordIdx];
+
+		shared_ptr<Address> address = make_shared<Address>(move(record.street),
+				record.postalCode, move(record.cityName), move(record.additionalInfo));
+
+		unsigned int matrikelNumber = (record.matrikelNumber != 0)
+				? record.matrikelNumber : matrikelBlock.allocate();
+
+		Student student(matrikelNumber, move(record.firstName), move(record.lastName),
+				record.dateOfBirth, address);
+
+		for(const EnrollmentRecord& enrollment : record.enrollments)
+		{
+			map<int, unique_ptr<const Course>>::const_iterator findCourse =
+					this->m_courses.find(enrollment.courseKey);
+
+			if(findCourse != this->m_courses.end())
+			{
+				student.addEnrollment(enrollment.semester, findCourse->second.get());
+				student.updateGrade(enrollment.grade, enrollment.courseKey);
+			}
+		}
+
+		bool isNew = this->m_students.insert(student);
+
+		//! A number of the reserved range may have been restored meanwhile, e.g. by
+		//! a concurrent load of a file, the student then gets a number above it.
+		while(!isNew && record.matrikelNumber == 0)
+		{
+			student = Student(Student::getMatrikelAllocator().allocate(), student);
+
+			isNew = this->m_students.insert(student);
+		}
+
+		if(!isNew)
+		{
+			//! Another record of this or a concurrent batch took the given number.
+			continue;
+		}
+
+		//! A change since the insertion is counted as difference, so the order does not matter.
+		this->accountEnrollments(student.getEnrollments(), 1);
+
+		if(record.matrikelNumber != 0)
+		{
+			lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+			this->m_studentFingerprints.insert(fingerprint);
+		}
+
+		if(matrikelNumbers != nullptr)
+		{
+			(*matrikelNumbers)[recordIdx] = student.getMatrikelNumber();
+		}
+
+		inserted++;
+	}
+
+	return inserted;
+}
+
+/*!
+ * @brief The first bytes of the binary format.
+ */
+static const char binaryMagic[4] = {'S', 'D', 'B', '1'};
+
+void StudentDb::writeBinary(std::ostream &out) const
+{
+	out.write(binaryMagic, sizeof(binaryMagic));
+
+	ShardedStudentMap::ReadView students = this->getStudents();
+
+	writeLittleEndian<uint32_t>(out, this->m_courses.size());
+
+	for(const pair<const int, unique_ptr<const Course>>& course: this->m_courses)
+	{
+		course.second->writeBinary(out);
+	}
+
+	writeLittleEndian<uint32_t>(out, students.size());
+
+	for(const pair<const int,Student>& student: students)
+	{
+		student.second.writeBinary(out);
+	}
+}
+
+void StudentDb::readBinary(std::istream &in)
+{
+	char magic[sizeof(binaryMagic)];
+
+	if(!in.read(magic, sizeof(magic)) ||
+			!equal(magic, magic + sizeof(magic), binaryMagic))
+	{
+		throw Poco::DataException("Not a StudentDb binary file");
+	}
+
+	//! Everything is read before the database is touched, so a damaged
+	//! file leaves the database as it was.
+	map<int, unique_ptr<const Course>> courses;
+
+	uint32_t noOfCourses = readLittleEndian<uint32_t>(in);
+
+	for(uint32_t idx = 0; idx < noOfCourses; idx++)
+	{
+		unique_ptr<Course> course = Course::readBinary(in);
+
+		if(course == nullptr)
+		{
+			throw Poco::DataException("Unknown course type in binary data");
+		}
+
+		int courseKey = course->getcourseKey();
+
+		courses[courseKey] = move(course);
+	}
+
+	vector<Student> students;
+
+	uint32_t noOfStudents = readLittleEndian<uint32_t>(in);
+
+	for(uint32_t idx = 0; idx < noOfStudents; idx++)
+	{
+		students.push_back(Student::readBinary(in, courses));
+	}
+
+	unique_lock<shared_timed_mutex> coursesLock(this->m_coursesMutex);
+
+	//! Replacing the database, the old courses end up in courses
+	//! and are released after the old students.
+	this->m_students.clear();
+	this->m_courses.swap(courses);
+	this->clearFingerprints();
+	this->clearCourseStatistics();
+
+	for(const Student& student : students)
+	{
+		uint64_t fingerprint = studentFingerprint(student);
+
+		if(this->m_students.insert(student))
+		{
+			this->accountEnrollments(student.getEnrollments(), 1);
+
+			lock_guard<mutex> fingerprintsLock(this->m_fingerprintsMutex);
+
+			this->m_studentFingerprints.insert(fingerprint);
+		}
+	}
+}
+
+void StudentDb::saveToFile(const std::string &fileName) const
+{
+	ofstream file(fileName, ios::binary | ios::trunc);
+
+	if(!file)
+	{
+		throw runtime_error("Cannot open " + fileName);
+	}
+
+	if(hasExtension(fileName, ".jsonl"))
+	{
+		this->writeJsonLines(file);
+	}
+	else if(hasExtension(fileName, ".json"))
+	{
+		this->writeJson(file);
+	}
+	else if(hasExtension(fileName, ".bin") || hasExtension(fileName, ".sdb"))
+	{
+		this->writeBinary(file);
+	}
+	else
+	{
+		this->write(file);
+	}
+
+	file.close();
+
+	if(!file)
+	{
+		throw runtime_error("Cannot write " + fileName);
+	}
+}
+
+void StudentDb::loadFromFile(const std::string &fileName)
+{
+	ifstream file(fileName, ios::binary);
+
+	if(!file)
+	{
+		throw runtime_error("Cannot open " + fileName);
+	}
+
+	if(hasExtension(fileName, ".jsonl"))
+	{
+		this->readJsonLines(file);
+	}
+	else if(hasExtension(fileName, ".json"))
+	{
+		this->readJson(file);
+	}
+	else if(hasExtension(fileName, ".bin") || hasExtension(fileName, ".sdb"))
+	{
+		this->readBinary(file);
+	}
+	else
+	{
+		this->read(file);
 	}
 }
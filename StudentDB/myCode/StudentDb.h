@@ -10,23 +10,44 @@
 #ifndef STUDENTDB_H_
 #define STUDENTDB_H_
 
+#include <iostream>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+
 #include "Student.h"
 #include "BlockCourse.h"
 #include "WeeklyCourse.h"
+#include "ImportRecords.h"
+#include "IngestionMetrics.h"
+#include "FingerprintSet.h"
+#include "CourseStatistics.h"
+#include "ShardedStudentMap.h"
+#include "WorkStealingPool.h"
 
 /*!
  * @class StudentDb
  * @brief Represents a database of students and
  * courses with various operations.
+ *
+ * All public methods may be called from several threads at once. The
+ * students are kept in a ShardedStudentMap, so operations on students
+ * in different shards run in parallel, and reads of all students such as
+ * the exports work on a snapshot that writers do not wait for. The
+ * courses have one reader-writer lock, shared by every operation on
+ * students, since the enrollments point to the courses. Locks are taken in the order courses, shards
+ * of the students, fingerprints. The private methods expect the locks
+ * to be held by their caller.
  */
 class StudentDb
 {
 private:
 	/*!
-	 * @var m_students - A map variable that maps the student
-	 * entered into the database with an integer key.
+	 * @var m_students - The students entered into the database, keyed by
+	 * matrikel number, sharded and versioned for concurrent access.
 	 */
-	std::map<int, Student> m_students;
+	ShardedStudentMap m_students;
 
 	/*!
 	 * @var m_courses - A map variable that stores the list of
@@ -34,6 +55,64 @@ private:
 	 */
 	std::map<int, std::unique_ptr<const Course>> m_courses;
 
+	/*!
+	 * @var m_coursesMutex - Exclusive for writers of m_courses and for
+	 * reading a complete database, shared by all other operations.
+	 */
+	mutable std::shared_timed_mutex m_coursesMutex;
+
+	/*!
+	 * @var m_serverHost - Host name of the generator server.
+	 */
+	std::string m_serverHost;
+
+	/*!
+	 * @var m_serverPort - Port of the generator server.
+	 */
+	unsigned short m_serverPort;
+
+	/*!
+	 * @var m_studentFingerprints - The fingerprints of all students, so
+	 * duplicates are found without comparing them with every student.
+	 */
+	FingerprintSet m_studentFingerprints;
+
+	/*!
+	 * @var m_fingerprintsMutex - Guards m_studentFingerprints, held
+	 * without waiting for any other lock.
+	 */
+	std::mutex m_fingerprintsMutex;
+
+	/*!
+	 * @var m_courseStatistics - The aggregates of the enrollments of
+	 * every course with enrollments, kept up to date with the students.
+	 */
+	std::map<int, CourseStatistics> m_courseStatistics;
+
+	/*!
+	 * @var m_courseStatisticsMutex - Guards m_courseStatistics, held
+	 * without waiting for any other lock.
+	 */
+	mutable std::mutex m_courseStatisticsMutex;
+
+	/*!
+	 * @var m_ingestionMetrics - The metrics of the last server ingestion.
+	 */
+	IngestionMetrics m_ingestionMetrics;
+
+	/*!
+	 * @var m_ingestionMutex - Held for a whole server ingestion, so
+	 * concurrent sessions fetch one at a time and do not reset each
+	 * other's metrics. Taken before any other lock.
+	 */
+	mutable std::mutex m_ingestionMutex;
+
+	/*!
+	 * @var m_workers - The pool running the parallel parts of the loaders
+	 * and exporters, shared with all other databases.
+	 */
+	WorkStealingPool& m_workers;
+
 private:
 	/*!
 	 * @brief Processes courses data from the input stream.
@@ -53,7 +132,7 @@ private:
 	 *
 	 * @param in The input stream containing students data.
 	 */
-	void readStudentsData(std::string &str);
+	void readStudentsData(std::string &str, std::vector<StudentRecord>& records);
 
 	/*!
 	 * @brief Processes enrollment data from the input stream.
@@ -83,7 +162,8 @@ private:
 	 *
 	 * @param out The output stream where student data will be printed.
 	 */
-	void writeStudentsData(std::ostream &out) const;
+	void writeStudentsData(std::ostream &out,
+			const ShardedStudentMap::ReadView& students) const;
 
 	/*!
 	 * @brief Print all Enrollments of the Student.
@@ -93,16 +173,25 @@ private:
 	 *
 	 * @param out The output stream where enrollment data will be printed.
 	 */
-	void writeEnrollmentsData(std::ostream &out) const;
+	void writeEnrollmentsData(std::ostream &out,
+			const ShardedStudentMap::ReadView& students) const;
+
+	/*!
+	 * @brief Converts the courses and the viewed students to JSON, see toJson().
+	 */
+	Poco::JSON::Object::Ptr toJson(const ShardedStudentMap::ReadView& students) const;
 
 	/*!
 	 * @brief Parses JSON data.
 	 *
-	 * This function uses POCO C++ JSON for parsing data.
+	 * The line is scanned once by ServerRecordScanner, which validates,
+	 * unescapes and converts the fields while it reads them.
 	 *
 	 * @param JSONData The JSON data to be parsed.
+	 * @param record Receives the student data.
+	 * @return True if the data was complete and valid.
 	 */
-	void parsingJSONData(std::string& JSONData);
+	bool parsingJSONData(std::string& JSONData, StudentRecord& record);
 
 	/*!
 	 * @brief Checks if the provided string is a valid server data string.
@@ -110,7 +199,139 @@ private:
 	 * @param eachStr The string to be checked.
 	 * @return True if the string is valid, false otherwise.
 	 */
-	bool isValidServerDataString(const std::string& eachStr);
+	static bool isValidServerDataString(const std::string& eachStr);
+
+	/*!
+	 * @brief Adds an already parsed course to the database,
+	 * replacing a course with the same key.
+	 *
+	 * @param course The parsed course.
+	 */
+	void insertCourse(std::unique_ptr<const Course> course);
+
+	/*!
+	 * @brief Computes the fingerprint that identifies a student for the
+	 * duplicate check: name and address, trimmed and compared ignoring
+	 * the case of ASCII letters.
+	 *
+	 * @return A 64 bit hash of the normalized fields.
+	 */
+	static std::uint64_t studentFingerprint(const std::string& firstName,
+			const std::string& lastName, const std::string& street,
+			unsigned short postalCode, const std::string& cityName,
+			const std::string& additionalInfo);
+
+	/*!
+	 * @brief Computes the fingerprint of a student in the database.
+	 */
+	static std::uint64_t studentFingerprint(const Student& student);
+
+	/*!
+	 * @brief Removes all fingerprints, when the database is cleared.
+	 */
+	void clearFingerprints();
+
+	/*!
+	 * @brief Adds enrollments to the course statistics, or removes them
+	 * if sign is -1.
+	 *
+	 * Called with the enrollments of a student before and after a change,
+	 * while the student is locked, so every change is counted once.
+	 *
+	 * @param enrollments The enrollments of a student.
+	 * @param sign 1 to add, -1 to remove.
+	 * @param courseKey Only the enrollments of this course, -1 for all.
+	 */
+	void accountEnrollments(const std::vector<Enrollment>& enrollments, int sign,
+			int courseKey = -1);
+
+	/*!
+	 * @brief Removes all course statistics, when the database is cleared.
+	 */
+	void clearCourseStatistics();
+
+	/*!
+	 * @brief Reads the response of the generator server to one
+	 * "generate" request.
+	 *
+	 * A response consists of the line "100 Generating", one line with
+	 * the JSON data and a final status line.
+	 *
+	 * @param in The stream connected to the server.
+	 * @param jsonLine Receives the line with the JSON data.
+	 * @return True if a complete response was read, false otherwise.
+	 */
+	static bool readServerResponse(std::istream& in, std::string& jsonLine);
+
+	/*!
+	 * @brief Exchanges "generate" requests and responses with the
+	 * generator server over one connection.
+	 *
+	 * Requests are sent as long as claimRequest grants them and fewer than
+	 * pipelineDepth requests wait for a response. claimRequest is called
+	 * with true if no request is in flight, it may then wait for work.
+	 * The connection is ended with "quit" once claimRequest refuses and
+	 * all responses have been passed to onResponse.
+	 *
+	 * @param address The address of the generator server.
+	 * @param pipelineDepth Maximum number of requests waiting for a response.
+	 * @param claimRequest Grants one more request, or refuses with false.
+	 * @param onResponse Receives the JSON line of every response.
+	 * @param inFlight Number of requests sent but not answered, non-zero
+	 * only if an exception ends the exchange.
+	 * @param metrics Receives the connect and request latencies.
+	 * @throws Poco::Exception if the connection fails, Poco::TimeoutException
+	 * if the server does not answer in time.
+	 */
+	static void exchangeServerRequests(const Poco::Net::SocketAddress& address,
+			unsigned int pipelineDepth, const std::function<bool(bool)>& claimRequest,
+			const std::function<void(std::string&)>& onResponse, unsigned int& inFlight,
+			IngestionMetrics& metrics);
+
+	/*!
+	 * @brief Inserts a batch of records received from the server with
+	 * addStudentsBatch() and records it in the ingestion metrics.
+	 *
+	 * @param records The valid records received.
+	 * @return Number of students added.
+	 */
+	unsigned int insertServerRecords(std::vector<StudentRecord> records);
+
+	/*!
+	 * @brief Adds a batch of already parsed students, see addStudentsBatch(),
+	 * with m_coursesMutex already locked.
+	 *
+	 * Exactly one number is reserved per new record without matrikel
+	 * number. If such a number was taken meanwhile, the student gets
+	 * another one, it is never dropped.
+	 *
+	 * @param matrikelNumbers Receives the matrikel number of every added
+	 * record and 0 for every duplicate, if not nullptr.
+	 */
+	unsigned int insertStudentRecords(std::vector<StudentRecord> records,
+			std::vector<unsigned int>* matrikelNumbers = nullptr);
+
+	/*!
+	 * @brief Updates a student under the lock of its shard and keeps its
+	 * fingerprint up to date.
+	 *
+	 * @throws std::out_of_range if there is no student with the matrikel number.
+	 */
+	void updateStudentIdentity(unsigned int matrikelNumber,
+			const std::function<void(Student&)>& writer);
+
+	/*!
+	 * @brief Checks if a student is enrolled in a course.
+	 */
+	static bool isEnrolled(const Student& student, unsigned int courseKey);
+
+	/*!
+	 * @brief Updates a student under the lock of its shard.
+	 *
+	 * @throws std::out_of_range if there is no student with the matrikel number.
+	 */
+	void updateStudent(unsigned int matrikelNumber,
+			const std::function<void(Student&)>& writer);
 
 public:
 	/**
@@ -142,19 +363,124 @@ public:
 	 */
 	virtual ~StudentDb();
 
+	/*!
+	 * @brief Sets the generator server used by the readStudentDataFromServer
+	 * methods, www.hhs.users.h-da.cloud:4242 by default.
+	 *
+	 * @param host Host name or address of the server.
+	 * @param port Port of the server.
+	 */
+	void setServerEndpoint(const std::string& host, unsigned short port);
+
+	/*!
+	 * @class CoursesView
+	 * @brief The courses of the database, with a shared lock held
+	 * as long as the view exists.
+	 */
+	class CoursesView
+	{
+	private:
+		/*!
+		 * @var m_lock - The shared lock on the courses.
+		 */
+		std::shared_lock<std::shared_timed_mutex> m_lock;
+
+		/*!
+		 * @var m_courses - The courses.
+		 */
+		const std::map<int, std::unique_ptr<const Course>>* m_courses;
+
+	public:
+		/*!
+		 * @brief Constructor, locks the courses of the database.
+		 */
+		explicit CoursesView(const StudentDb& db);
+
+		/*!
+		 * @brief Range, size and lookup of the courses, as in std::map.
+		 */
+		std::map<int, std::unique_ptr<const Course>>::const_iterator begin() const;
+		std::map<int, std::unique_ptr<const Course>>::const_iterator end() const;
+		std::size_t size() const;
+		std::map<int, std::unique_ptr<const Course>>::const_iterator find(int courseKey) const;
+	};
+
 	/*!
 	 * @brief Getter method to fetch the students.
 	 *
-	 * @return Map representing the students.
+	 * The view is a snapshot, other threads may change the students while
+	 * it exists, but not the courses.
+	 *
+	 * @return View of all students, sorted by matrikel number.
 	 */
-	const std::map<int, Student>& getStudents() const;
+	ShardedStudentMap::ReadView getStudents() const;
 
 	/*!
 	 * @brief Getter method to fetch the courses.
 	 *
-	 * @return Map representing the courses.
+	 * Other threads cannot change the courses as long as the view exists.
+	 *
+	 * @return View of all courses.
 	 */
-	const std::map<int, std::unique_ptr<const Course>>& getCourses() const;
+	CoursesView getCourses() const;
+
+	/*!
+	 * @brief Getter method for the number of students, without locking them.
+	 */
+	std::size_t getNoOfStudents() const;
+
+	/*!
+	 * @brief Calls reader with a student, which cannot change meanwhile.
+	 *
+	 * Only the shard of the student is locked, so this does not wait for
+	 * writers of other students.
+	 *
+	 * @param matrikelNumber Matrikel number of the student.
+	 * @param reader Receives the student.
+	 * @return False if there is no student with the matrikel number.
+	 */
+	bool readStudent(unsigned int matrikelNumber,
+			const std::function<void(const Student&)>& reader) const;
+
+	/*!
+	 * @brief Getter method for a copy of a student.
+	 *
+	 * @param matrikelNumber Matrikel number of the student.
+	 * @throws std::out_of_range if there is no student with the matrikel number.
+	 */
+	Student getStudent(unsigned int matrikelNumber) const;
+
+	/*!
+	 * @brief Writes the metrics of the last server ingestion as JSON,
+	 * see IngestionMetrics::writeJson().
+	 *
+	 * Waits for a server ingestion that is still running.
+	 */
+	void writeIngestionMetrics(std::ostream& out) const;
+
+	/*!
+	 * @brief Ranks all students with graded enrollments by their credit
+	 * weighted grade point average.
+	 *
+	 * The averages are kept up to date by the students, so the ranking
+	 * needs one pass over a snapshot of the students and a sort.
+	 *
+	 * @return Matrikel number and average, best grade first, students
+	 * with the same average by matrikel number.
+	 */
+	std::vector<std::pair<unsigned int, float>> rankByGpa() const;
+
+	/*!
+	 * @brief Getter method for the enrollment and grade statistics of a course.
+	 *
+	 * The statistics are kept up to date with the enrollments, so this
+	 * does not visit the students.
+	 *
+	 * @param courseKey Key of the course.
+	 * @return A copy of the statistics.
+	 * @throws std::out_of_range if there is no course with the key.
+	 */
+	CourseStatistics getCourseStatistics(int courseKey) const;
 
 	/*!
 	 * @brief Add a new course to the database.
@@ -185,6 +511,36 @@ public:
 			std::string& postalCode,std::string& cityName,
 			std::string& additionalInfo);
 
+	/*!
+	 * @brief Adds a batch of already parsed students to the database.
+	 *
+	 * Records with a matrikel number keep it and are duplicates if the
+	 * number is taken. Records without a matrikel number (0) get the next
+	 * free one and are duplicates if a student with the same name and
+	 * address exists, see studentFingerprint(). The fingerprints of all
+	 * students are kept between batches, so a record is checked in O(1)
+	 * before its Student is built. Both checks cover the database and the
+	 * batch itself and batches added by other threads at the same time.
+	 * The remaining students, with their enrollments in existing courses,
+	 * are then inserted in one pass.
+	 *
+	 * @param records The parsed student data, consumed by the batch.
+	 * @return Number of students added, the others were duplicates.
+	 */
+	unsigned int addStudentsBatch(std::vector<StudentRecord> records);
+
+	/*!
+	 * @brief Adds a batch of already parsed students, see addStudentsBatch(),
+	 * and reports the outcome of every record.
+	 *
+	 * @param records The parsed student data, consumed by the batch.
+	 * @param matrikelNumbers Receives, in the order of the records, the
+	 * matrikel number of every added student and 0 for every duplicate.
+	 * @return Number of students added, the others were duplicates.
+	 */
+	unsigned int addStudentsBatch(std::vector<StudentRecord> records,
+			std::vector<unsigned int>& matrikelNumbers);
+
 	/*!
 	 * @brief Add enrollment for a student.
 	 *
@@ -242,8 +598,10 @@ public:
 	 *
 	 * @param courseKey Key of the course to be deleted.
 	 * @param matrikelNumber Matrikel number of the student.
+	 * @return RC_Success, RC_Wrong_MatrikelNumber if there is no such
+	 * student or RC_Wrong_Course_Key if the student is not enrolled.
 	 */
-	void deleteEnrollment(const unsigned int& courseKey,
+	RC_StudentDb_t deleteEnrollment(const unsigned int& courseKey,
 			const unsigned int matrikelNumber);
 
 	/**
@@ -252,8 +610,10 @@ public:
 	 * @param courseKey Key of the course.
 	 * @param newGrade New grade to be assigned.
 	 * @param matrikelNumber Matrikel number of the student.
+	 * @return RC_Success, RC_Wrong_MatrikelNumber if there is no such
+	 * student or RC_Wrong_Course_Key if the student is not enrolled.
 	 */
-	void updateGrade(const unsigned int& courseKey, const float& newGrade,
+	RC_StudentDb_t updateGrade(const unsigned int& courseKey, const float& newGrade,
 			const unsigned int matrikelNumber);
 
 	/*!
@@ -282,9 +642,125 @@ public:
 	/*!
 	 * @brief Reads data from the server.
 	 *
+	 * Like all methods reading from the server, the run is recorded in
+	 * the ingestion metrics and their summary is printed at the end.
+	 *
 	 * @param noOfUserData Number of user data to be read from the server.
+	 * @param report Receives the progress, the errors and the summary,
+	 * e.g. the stream of a remote session.
 	 */
-	void readStudentDataFromServer(unsigned int noOfUserData);
+	void readStudentDataFromServer(unsigned int noOfUserData,
+			std::ostream& report = std::cout);
+
+	/*!
+	 * @brief Reads data from the server over one persistent connection.
+	 *
+	 * Up to pipelineDepth "generate" requests are sent ahead of the
+	 * responses, so the transfer is not limited by the round trip time.
+	 * The connection is ended with "quit" once all responses are read.
+	 *
+	 * @param noOfUserData Number of user data to be read from the server.
+	 * @param report Receives the errors and the summary.
+	 * @param pipelineDepth Maximum number of requests waiting for a response.
+	 * @return Number of responses received.
+	 */
+	unsigned int readStudentDataFromServerPipelined(unsigned int noOfUserData,
+			std::ostream& report = std::cout, unsigned int pipelineDepth = 32);
+
+	/*!
+	 * @brief Reads data from the server over several connections in parallel.
+	 *
+	 * Every connection is served by its own worker thread, which pipelines
+	 * its requests and parses the responses. The parsed records are passed
+	 * through a bounded queue to the calling thread, the only thread that
+	 * inserts into the database. Requests are claimed from a shared count,
+	 * so exactly noOfUserData responses are requested. The requests a failed
+	 * connection did not get answered are taken over by the other connections.
+	 * The errors and the record counts are reported per connection.
+	 *
+	 * @param noOfUserData Number of user data to be read from the server.
+	 * @param report Receives the errors, the counts and the summary.
+	 * @param noOfConnections Number of connections to the server.
+	 * @param pipelineDepth Maximum number of requests waiting for a
+	 * response, per connection.
+	 * @return Number of students added to the database.
+	 */
+	unsigned int readStudentDataFromServerParallel(unsigned int noOfUserData,
+			std::ostream& report = std::cout, unsigned int noOfConnections = 4,
+			unsigned int pipelineDepth = 32);
+
+	/*!
+	 * @brief Reads data from the server with asynchronous sockets.
+	 *
+	 * Many connections with pipelined requests are multiplexed on a few
+	 * threads by an AsyncServerIngestion. The responses are parsed on these
+	 * threads while other connections wait for data, and the calling thread
+	 * inserts the records into the database.
+	 *
+	 * @param noOfUserData Number of user data to be read from the server.
+	 * @param report Receives the errors, the counts and the summary.
+	 * @param noOfConnections Number of connections to the server.
+	 * @param pipelineDepth Maximum number of requests waiting for a
+	 * response, per connection.
+	 * @param noOfThreads Number of threads for the socket I/O and the parsing.
+	 * @return Number of students added to the database.
+	 */
+	unsigned int readStudentDataFromServerAsync(unsigned int noOfUserData,
+			std::ostream& report = std::cout, unsigned int noOfConnections = 16,
+			unsigned int pipelineDepth = 32, unsigned int noOfThreads = 2);
+
+	/*!
+	 * @brief Reads data from the server through a pipeline of stages.
+	 *
+	 * Every stage runs on its own thread: the fetch stage pipelines the
+	 * requests over one connection, the parse stage parses the JSON data,
+	 * the extraction stage validates, unescapes and converts the fields,
+	 * and the calling thread constructs the students and inserts them.
+	 * The stages are connected by lock-free SpscRing buffers, a stage
+	 * waits while the ring to its successor is full. A record that fails
+	 * extraction, also by an exception, is counted as rejected.
+	 *
+	 * @param noOfUserData Number of user data to be read from the server.
+	 * @param report Receives the errors, the counts and the summary.
+	 * @param pipelineDepth Maximum number of requests waiting for a response.
+	 * @param ringCapacity Number of elements each ring between two stages holds.
+	 * @return Number of students added to the database.
+	 */
+	unsigned int readStudentDataFromServerStaged(unsigned int noOfUserData,
+			std::ostream& report = std::cout, unsigned int pipelineDepth = 32,
+			unsigned int ringCapacity = 1024);
+
+	/*!
+	 * @brief Replays captured generator server responses.
+	 *
+	 * Every line of the input that holds JSON data is passed through the
+	 * same parsing, validation and insertion as a response received from
+	 * the server, other lines such as the status lines are skipped. The
+	 * time spent in parsing, in extraction and validation and in insertion
+	 * is measured separately and printed with the record counts.
+	 *
+	 * @param in The captured responses, e.g. written by
+	 * GeneratorServer::writeResponses().
+	 * @param report Receives the record counts and the times.
+	 * @return Number of students added to the database.
+	 */
+	unsigned int replayServerData(std::istream& in, std::ostream& report = std::cout);
+
+	/*!
+	 * @brief Extracts the student data of one generator server response.
+	 *
+	 * Walks the "name", "dateOfBirth" and "location" objects of the parsed
+	 * response once. Every field is read straight from the parsed object,
+	 * string fields are validated and unescaped once, numeric fields are
+	 * converted once. The matrikel number of the record is not set.
+	 *
+	 * @param data The parsed JSON object of the server response.
+	 * @param record The record that receives the student data.
+	 * @return True if all fields were present and valid and the date of
+	 * birth exists, false otherwise.
+	 */
+	static bool extractServerRecord(const Poco::JSON::Object& data,
+			StudentRecord& record);
 
 	/**
 	 * @brief Convert the object to a Poco::JSON::Object::Ptr.
@@ -309,6 +785,100 @@ public:
 	 */
 	void fromJson(Poco::JSON::Object::Ptr data);
 
+	/*!
+	 * @brief Writes the database as indented JSON, in the format of toJson().
+	 *
+	 * The students are partitioned into contiguous ranges. Every range is
+	 * serialized into its own buffer on the WorkStealingPool and the
+	 * buffers are written in order, so the output is byte-identical to
+	 * stringifying toJson() with an indent of 2 on a single thread.
+	 *
+	 * @param out The output stream where the JSON data will be written.
+	 * @param noOfThreads Number of ranges, 0 uses four per worker of the
+	 * pool and 1 stringifies toJson() directly.
+	 */
+	void writeJson(std::ostream& out, unsigned int noOfThreads = 0) const;
+
+	/*!
+	 * @brief Reads the complete database from JSON data in the input stream.
+	 *
+	 * The database is replaced by the courses, students, addresses and
+	 * enrollments in the format written by toJson(). The data is processed
+	 * in one pass by a JsonImportHandler, without building the JSON object
+	 * tree in memory, and added in batches to a staging database, which
+	 * replaces this one only if the data was parsed completely. Besides the
+	 * staged database only one batch of records is held. The courses must
+	 * come before the students, as in the output of toJson().
+	 *
+	 * @param in The input stream to read the JSON data from.
+	 */
+	void readJson(std::istream& in);
+
+	/*!
+	 * @brief Writes the database in the JSON Lines format.
+	 *
+	 * Every line holds one compact JSON object, either {"course": {...}}
+	 * with the data of one course or {"student": {...}} with the data of
+	 * one student including the address and the enrollments. All courses
+	 * are written before the students.
+	 *
+	 * @param out The output stream where the JSON lines will be written.
+	 */
+	void writeJsonLines(std::ostream& out) const;
+
+	/*!
+	 * @brief Reads the complete database from data in the JSON Lines format.
+	 *
+	 * The input is split at the line ends into four chunks per worker of
+	 * the WorkStealingPool and the chunks are parsed in parallel. The parsed courses and then the
+	 * parsed students are merged into the database in the order of the input.
+	 * The database is only cleared once all lines have been parsed, so a
+	 * malformed line leaves the current data untouched.
+	 *
+	 * @param in The input stream to read the JSON lines from.
+	 */
+	void readJsonLines(std::istream& in);
+
+	/*!
+	 * @brief Writes the complete database in the binary format.
+	 *
+	 * The data starts with the magic "SDB1", followed by the number of
+	 * courses, the courses, the number of students and the students with
+	 * their addresses and enrollments. All integers are little endian.
+	 *
+	 * @param out The output stream where the data will be written.
+	 */
+	void writeBinary(std::ostream& out) const;
+
+	/*!
+	 * @brief Reads the complete database from data written by writeBinary().
+	 *
+	 * The data is read completely before it replaces the database,
+	 * so the database is unchanged if reading fails.
+	 *
+	 * @param in The input stream to read the binary data from.
+	 * @throws Poco::DataException if the data is not in the binary format.
+	 */
+	void readBinary(std::istream& in);
+
+	/*!
+	 * @brief Writes the complete database to a file, in the format given
+	 * by its extension: ".json", ".jsonl", ".bin" or ".sdb" for the binary
+	 * format and the text format of write() for any other.
+	 *
+	 * @param fileName Name of the file, replaced if it exists.
+	 * @throws std::runtime_error if the file cannot be written.
+	 */
+	void saveToFile(const std::string& fileName) const;
+
+	/*!
+	 * @brief Reads the complete database from a file written by saveToFile().
+	 *
+	 * @param fileName Name of the file, its extension selects the format.
+	 * @throws std::runtime_error if the file cannot be opened.
+	 */
+	void loadFromFile(const std::string& fileName);
+
 };
 
 #endif /* STUDENTDB_H_ */
@@ -9,6 +9,8 @@
 
 #include "WeeklyCourse.h"
 
+#include "ModelFields.h"
+
 using namespace std;
 
 WeeklyCourse::WeeklyCourse(unsigned int courseKey, std::string title,
@@ -43,11 +45,9 @@ void WeeklyCourse::write(std::ostream &out) const
 {
 	out << "W;";
 
-	Course::write(out);
+	writeFieldsText(out, *this, weeklyCourseFields());
 
-	out << ";" << to_string(this->m_daysOfWeek)
-				<< ";" << timetoString(this->m_startTime)
-				<< ";" << timetoString(this->m_endTime) << endl;
+	out << endl;
 }
 
 std::unique_ptr<WeeklyCourse> WeeklyCourse::read(std::istream &in)
@@ -56,38 +56,42 @@ std::unique_ptr<WeeklyCourse> WeeklyCourse::read(std::istream &in)
 
 	getline(in, inStr);
 
-	string courseKey = splitAt(inStr, ';');
-	string title = splitAt(inStr, ';');
-	string major = splitAt(inStr, ';');
-	string creditPoints = splitAt(inStr, ';');
-    string semester = splitAt(inStr, ';');
-	string dayOfWeek = splitAt(inStr, ';');
-	string startTime = splitAt(inStr, ';');
-	string endTime = splitAt(inStr, '\n');
-
-	return make_unique<WeeklyCourse>
-	(stoi(courseKey), title, major, stof(creditPoints), semester, getDayOfWeekFromString(dayOfWeek),
-			timeFromString(startTime), timeFromString(endTime));
+	auto values = readFieldsText(inStr, weeklyCourseFields());
+
+	return applyValues([](auto&&... fields)
+			{ return make_unique<WeeklyCourse>(forward<decltype(fields)>(fields)...); }, values);
 }
 
 Poco::JSON::Object::Ptr WeeklyCourse::toJson() const
 {
 	Poco::JSON::Object::Ptr returnObj = new Poco::JSON::Object;
 
-	Poco::JSON::Object::Ptr courseJSON = Course::toJson();
+	returnObj->set("courseType", "W");
 
-	Poco::Dynamic::Var courseType("W");
+	writeFieldsJson(*returnObj, *this, weeklyCourseFields());
 
-	returnObj->set("courseType", courseType);
+	return returnObj;
+}
 
-	for(const string& key: courseJSON->getNames())
-	{
-		returnObj->set(key, courseJSON->get(key));
-	}
+std::unique_ptr<WeeklyCourse> WeeklyCourse::fromJson(Poco::JSON::Object::Ptr data)
+{
+	auto values = readFieldsJson(*data, weeklyCourseFields());
 
-	returnObj->set("dayOfWeek", static_cast<int>(this->m_daysOfWeek));
-	returnObj->set("startTime", timetoString(this->m_startTime));
-	returnObj->set("endTime", timetoString(this->m_endTime));
+	return applyValues([](auto&&... fields)
+			{ return make_unique<WeeklyCourse>(forward<decltype(fields)>(fields)...); }, values);
+}
 
-	return returnObj;
+void WeeklyCourse::writeBinary(std::ostream &out) const
+{
+	writeLittleEndian<uint8_t>(out, 'W');
+
+	writeFieldsBinary(out, *this, weeklyCourseFields());
+}
+
+std::unique_ptr<WeeklyCourse> WeeklyCourse::readBinary(std::istream &in)
+{
+	auto values = readFieldsBinary(in, weeklyCourseFields());
+
+	return applyValues([](auto&&... fields)
+			{ return make_unique<WeeklyCourse>(forward<decltype(fields)>(fields)...); }, values);
 }
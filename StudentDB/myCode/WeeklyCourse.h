@@ -114,6 +114,32 @@ public:
 	 */
 	Poco::JSON::Object::Ptr toJson() const override;
 
+	/*!
+	 * @brief Creates a WeeklyCourse object from JSON data.
+	 *
+	 * @param data A pointer to the Poco::JSON::Object containing JSON data.
+	 * @return A unique pointer to the constructed WeeklyCourse object.
+	 * @throws Poco::NotFoundException if a member is missing.
+	 */
+	static std::unique_ptr<WeeklyCourse> fromJson(Poco::JSON::Object::Ptr data);
+
+	/*!
+	 * @brief Write the object's data in the binary format,
+	 * preceded by the type tag 'W'.
+	 *
+	 * @param out The output stream where the object's data will be written.
+	 */
+	void writeBinary(std::ostream& out) const override;
+
+	/*!
+	 * @brief Reads a WeeklyCourse written by writeBinary(), after the type tag.
+	 *
+	 * @param in The input stream from which to read the WeeklyCourse.
+	 * @return A unique pointer to the constructed WeeklyCourse object.
+	 * @throws Poco::DataException if the input ends early.
+	 */
+	static std::unique_ptr<WeeklyCourse> readBinary(std::istream& in);
+
 };
 
 #endif /* WEEKLYCOURSE_H_ */
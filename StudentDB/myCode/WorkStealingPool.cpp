@@ -0,0 +1,274 @@
+/*!
+ * @file WorkStealingPool.cpp
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+/*!
+ * @brief The pool of the current thread, nullptr outside of the workers.
+ */
+static thread_local WorkStealingPool* t_pool = nullptr;
+
+/*!
+ * @brief The index of the current worker in t_pool.
+ */
+static thread_local unsigned int t_workerIdx = 0;
+
+WorkStealingPool::TaskGroup::TaskGroup(WorkStealingPool &pool) :
+		m_pool(pool), m_pending(0)
+{
+}
+
+WorkStealingPool::TaskGroup::~TaskGroup()
+{
+	try
+	{
+		this->wait();
+	}
+	catch(...)
+	{
+		//! Not waited for by the owner, the error is dropped.
+	}
+}
+
+void WorkStealingPool::TaskGroup::run(std::function<void()> task)
+{
+	this->m_pending++;
+
+	this->m_pool.push([this, task]()
+	{
+		try
+		{
+			task();
+		}
+		catch(...)
+		{
+			lock_guard<mutex> lock(this->m_mutex);
+
+			if(!this->m_error)
+			{
+				this->m_error = current_exception();
+			}
+		}
+
+		//! Under the mutex, so wait() cannot return while the group is still used.
+		lock_guard<mutex> lock(this->m_mutex);
+
+		if(--this->m_pending == 0)
+		{
+			this->m_finished.notify_all();
+		}
+	});
+}
+
+void WorkStealingPool::TaskGroup::wait()
+{
+	//! A worker waiting inside a task runs queued tasks, so the pool cannot
+	//! run out of workers. Other threads must not take the workers' tasks.
+	if(t_pool == &this->m_pool)
+	{
+		while(this->m_pending.load() != 0 && this->m_pool.tryRunOne())
+		{
+		}
+	}
+
+	//! The rest of the tasks is running, the last one to finish notifies.
+	unique_lock<mutex> lock(this->m_mutex);
+
+	this->m_finished.wait(lock, [this](){ return this->m_pending.load() == 0; });
+
+	if(this->m_error)
+	{
+		exception_ptr error = this->m_error;
+
+		this->m_error = nullptr;
+
+		rethrow_exception(error);
+	}
+}
+
+WorkStealingPool::WorkStealingPool(unsigned int noOfWorkers) :
+		m_noOfQueued(0), m_nextQueue(0), m_stop(false)
+{
+	if(noOfWorkers == 0)
+	{
+		noOfWorkers = max(thread::hardware_concurrency(), 1u);
+	}
+
+	for(unsigned int workerIdx = 0; workerIdx < noOfWorkers; workerIdx++)
+	{
+		this->m_queues.emplace_back(new WorkerQueue);
+	}
+
+	for(unsigned int workerIdx = 0; workerIdx < noOfWorkers; workerIdx++)
+	{
+		this->m_workers.emplace_back(&WorkStealingPool::workerLoop, this, workerIdx);
+	}
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		lock_guard<mutex> lock(this->m_sleepMutex);
+
+		this->m_stop = true;
+	}
+
+	this->m_wakeUp.notify_all();
+
+	for(thread& worker : this->m_workers)
+	{
+		worker.join();
+	}
+}
+
+WorkStealingPool& WorkStealingPool::shared()
+{
+	static WorkStealingPool pool;
+
+	return pool;
+}
+
+unsigned int WorkStealingPool::getNoOfWorkers() const
+{
+	return this->m_workers.size();
+}
+
+void WorkStealingPool::push(std::function<void()> task)
+{
+	unsigned int queueIdx = (t_pool == this) ? t_workerIdx
+			: this->m_nextQueue++ % this->m_queues.size();
+
+	//! Counted first, so a worker never sees a task that is not counted.
+	this->m_noOfQueued++;
+
+	{
+		lock_guard<mutex> lock(this->m_queues[queueIdx]->mutex);
+
+		this->m_queues[queueIdx]->tasks.push_back(move(task));
+	}
+
+	{
+		//! A worker about to sleep has either seen the task or gets the signal.
+		lock_guard<mutex> lock(this->m_sleepMutex);
+	}
+
+	this->m_wakeUp.notify_one();
+}
+
+bool WorkStealingPool::tryRunOne()
+{
+	bool isWorker = (t_pool == this);
+
+	unsigned int noOfQueues = this->m_queues.size();
+
+	unsigned int homeIdx = isWorker ? t_workerIdx : this->m_nextQueue.load() % noOfQueues;
+
+	function<void()> task;
+
+	for(unsigned int offset = 0; offset < noOfQueues && !task; offset++)
+	{
+		WorkerQueue& queue = *this->m_queues[(homeIdx + offset) % noOfQueues];
+
+		lock_guard<mutex> lock(queue.mutex);
+
+		if(queue.tasks.empty())
+		{
+			continue;
+		}
+
+		//! The own newest task is likely still in the cache, others are stolen oldest first.
+		if(isWorker && offset == 0)
+		{
+			task = move(queue.tasks.back());
+			queue.tasks.pop_back();
+		}
+		else
+		{
+			task = move(queue.tasks.front());
+			queue.tasks.pop_front();
+		}
+	}
+
+	if(!task)
+	{
+		return false;
+	}
+
+	this->m_noOfQueued--;
+
+	task();
+
+	return true;
+}
+
+void WorkStealingPool::workerLoop(unsigned int workerIdx)
+{
+	t_pool = this;
+	t_workerIdx = workerIdx;
+
+	while(true)
+	{
+		if(this->tryRunOne())
+		{
+			continue;
+		}
+
+		unique_lock<mutex> lock(this->m_sleepMutex);
+
+		this->m_wakeUp.wait(lock,
+				[this](){ return this->m_stop || this->m_noOfQueued.load() > 0; });
+
+		if(this->m_stop && this->m_noOfQueued.load() == 0)
+		{
+			return;
+		}
+	}
+}
+
+void WorkStealingPool::submit(std::function<void()> task)
+{
+	this->push(move(task));
+}
+
+void WorkStealingPool::parallelFor(std::size_t begin, std::size_t end,
+		const std::function<void(std::size_t, std::size_t)> &body, std::size_t grainSize)
+{
+	if(end <= begin)
+	{
+		return;
+	}
+
+	if(grainSize == 0)
+	{
+		grainSize = max<size_t>((end - begin) / (this->getNoOfWorkers() * 8), 1);
+	}
+
+	if(end - begin <= grainSize)
+	{
+		body(begin, end);
+
+		return;
+	}
+
+	TaskGroup group(*this);
+
+	for(size_t first = begin; first < end; first += grainSize)
+	{
+		size_t last = min(end, first + grainSize);
+
+		group.run([&body, first, last](){ body(first, last); });
+	}
+
+	group.wait();
+}
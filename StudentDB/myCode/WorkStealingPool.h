@@ -0,0 +1,221 @@
+/*!
+ * @file WorkStealingPool.h
+ *
+ * \n Created on: 19-Oct-2026
+ * @author Girish Tabaraddi
+ *
+ * Built on: \showdate "%A %d-%m-%Y %H:%M:%S"
+ */
+
+#ifndef WORKSTEALINGPOOL_H_
+#define WORKSTEALINGPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * @class WorkStealingPool
+ * @brief A fixed set of worker threads for CPU bound work, one per core.
+ *
+ * Every worker has its own deque of tasks. A worker takes its newest
+ * task first and, once its deque is empty, steals the oldest task of
+ * another worker, so uneven tasks spread over all cores. Tasks are
+ * grouped in a TaskGroup. Called by a worker, its wait() runs queued
+ * tasks before it blocks, so a task may start and wait for further tasks
+ * without running out of workers.
+ *
+ * All parallel work of the database runs on the pool returned by
+ * shared(), so several operations at once never start more threads
+ * than there are cores.
+ */
+class WorkStealingPool
+{
+public:
+	/*!
+	 * @class TaskGroup
+	 * @brief Tasks run on a pool and waited for together.
+	 */
+	class TaskGroup
+	{
+	private:
+		/*!
+		 * @var m_pool - The pool the tasks run on.
+		 */
+		WorkStealingPool& m_pool;
+
+		/*!
+		 * @var m_pending - Number of tasks started and not yet finished.
+		 */
+		std::atomic<std::size_t> m_pending;
+
+		/*!
+		 * @var m_mutex - Guards m_error, used with m_finished.
+		 */
+		std::mutex m_mutex;
+
+		/*!
+		 * @var m_finished - Signalled when the last pending task finished.
+		 */
+		std::condition_variable m_finished;
+
+		/*!
+		 * @var m_error - The first exception thrown by a task.
+		 */
+		std::exception_ptr m_error;
+
+	public:
+		/*!
+		 * @brief Constructor of an empty group.
+		 */
+		explicit TaskGroup(WorkStealingPool& pool);
+
+		/*!
+		 * @brief Destructor, waits for the tasks still running.
+		 */
+		~TaskGroup();
+
+		TaskGroup(const TaskGroup&) = delete;
+		TaskGroup& operator=(const TaskGroup&) = delete;
+
+		/*!
+		 * @brief Starts a task on the pool.
+		 */
+		void run(std::function<void()> task);
+
+		/*!
+		 * @brief Waits until all tasks of the group are finished. A worker
+		 * of the pool runs queued tasks meanwhile, other threads block.
+		 *
+		 * @throws The first exception thrown by a task of the group.
+		 */
+		void wait();
+	};
+
+private:
+	/*!
+	 * @brief The deque of one worker, allocated on its own, so the workers
+	 * do not share the cache lines of their mutexes.
+	 */
+	struct WorkerQueue
+	{
+		/*!
+		 * @var mutex - Guards tasks, held for a push or a pop only.
+		 */
+		std::mutex mutex;
+
+		/*!
+		 * @var tasks - The owner works at the back, thieves at the front.
+		 */
+		std::deque<std::function<void()>> tasks;
+	};
+
+	/*!
+	 * @var m_queues - The deque of every worker.
+	 */
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+	/*!
+	 * @var m_workers - The worker threads.
+	 */
+	std::vector<std::thread> m_workers;
+
+	/*!
+	 * @var m_noOfQueued - Number of tasks in all deques.
+	 */
+	std::atomic<std::size_t> m_noOfQueued;
+
+	/*!
+	 * @var m_nextQueue - Deque of the next task started outside the pool.
+	 */
+	std::atomic<unsigned int> m_nextQueue;
+
+	/*!
+	 * @var m_sleepMutex - Used with m_wakeUp, guards m_stop.
+	 */
+	std::mutex m_sleepMutex;
+
+	/*!
+	 * @var m_wakeUp - Signalled when a task was queued or the pool stops.
+	 */
+	std::condition_variable m_wakeUp;
+
+	/*!
+	 * @var m_stop - Set by the destructor to end the workers.
+	 */
+	bool m_stop;
+
+	/*!
+	 * @brief Queues a task, on the own deque if called by a worker.
+	 */
+	void push(std::function<void()> task);
+
+	/*!
+	 * @brief Runs one queued task, the newest of the own deque or the
+	 * oldest of another one.
+	 *
+	 * @return False if no task was queued.
+	 */
+	bool tryRunOne();
+
+	/*!
+	 * @brief The loop of a worker thread.
+	 */
+	void workerLoop(unsigned int workerIdx);
+
+public:
+	/*!
+	 * @brief Constructor, starts the workers.
+	 *
+	 * @param noOfWorkers Number of workers, 0 for one per hardware thread.
+	 */
+	explicit WorkStealingPool(unsigned int noOfWorkers = 0);
+
+	/*!
+	 * @brief Destructor, runs the queued tasks and ends the workers.
+	 */
+	~WorkStealingPool();
+
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+	/*!
+	 * @brief Returns the pool shared by all parallel work of the program.
+	 */
+	static WorkStealingPool& shared();
+
+	/*!
+	 * @brief Getter method for the number of workers.
+	 */
+	unsigned int getNoOfWorkers() const;
+
+	/*!
+	 * @brief Starts a task no TaskGroup waits for.
+	 *
+	 * The task has to catch its exceptions, e.g. by setting them on a
+	 * std::promise. The destructor of the pool runs it if not yet done.
+	 */
+	void submit(std::function<void()> task);
+
+	/*!
+	 * @brief Calls body for consecutive subranges of [begin, end) in
+	 * parallel and waits for all of them.
+	 *
+	 * @param begin First index of the range.
+	 * @param end Index behind the range.
+	 * @param body Called with the first index and the index behind a subrange.
+	 * @param grainSize Size of the subranges, 0 for about eight per worker.
+	 * @throws The first exception thrown by body.
+	 */
+	void parallelFor(std::size_t begin, std::size_t end,
+			const std::function<void(std::size_t, std::size_t)>& body,
+			std::size_t grainSize = 0);
+};
+
+#endif /* WORKSTEALINGPOOL_H_ */
@@ -9,6 +9,8 @@
 
 #include "helperFunctions.h"
 
+#include <stdexcept>
+
 using namespace std;
 
 std::string pocoDateToStringFormatter(const Poco::Data::Date &date)
@@ -153,20 +155,42 @@ std::string splitAt(std::string &input, char delimiter)
 	return returnStr;
 }
 
+bool hasExtension(const std::string &fileName, const std::string &extension)
+{
+	return fileName.size() >= extension.size()
+			&& fileName.compare(fileName.size() - extension.size(),
+					extension.size(), extension) == 0;
+}
+
 void getUserInput(const std::string &prompt, const std::string &inputPattern,
 		std::string &userInput)
+{
+	getUserInput(cin, cout, prompt, inputPattern, userInput);
+}
+
+void getUserInput(std::istream &in, std::ostream &out, const std::string &prompt,
+		const std::string &inputPattern, std::string &userInput)
 {
 	bool checkInput = false;
 
 	while(!checkInput)
 	{
-		cout << prompt;
-		getline(cin, userInput);
+		out << prompt;
+		out.flush();
+
+		if(!getline(in, userInput))
+		{
+			throw runtime_error("End of user input");
+		}
+
+		if(!userInput.empty() && userInput.back() == '\r')
+		{
+			userInput.pop_back();
+		}
 
 		if(!regex_match(userInput, regex(inputPattern)))
 		{
-			cerr << "Invalid input format. Please try again." << endl;
-			cout.flush();
+			out << "Invalid input format. Please try again." << endl;
 			checkInput = false;
 		}
 		else
@@ -95,6 +95,15 @@ Poco::DateTime::DaysOfWeek getDayOfWeekFromString(const std::string& dayString);
  */
 std::string splitAt(std::string& remainder, char delimiter);
 
+/*!
+ * @brief Checks if a file name ends with an extension.
+ *
+ * @param fileName The file name to be checked.
+ * @param extension The extension including the dot, e.g. ".json".
+ * @return True if fileName ends with extension.
+ */
+bool hasExtension(const std::string& fileName, const std::string& extension);
+
 /**
  * @brief Get user input based on a specified prompt and input pattern.
  *
@@ -109,6 +118,23 @@ std::string splitAt(std::string& remainder, char delimiter);
 void getUserInput(const std::string& prompt, const std::string& inputPattern,
                   std::string& userInput);
 
+/**
+ * @brief Get user input based on a specified prompt and input pattern,
+ * over the given streams.
+ *
+ * Like getUserInput() on std::cin and std::cout, but the prompt and the
+ * error message are written to out, which is flushed before every read.
+ *
+ * @param in The stream the user input is read from.
+ * @param out The stream the prompt is written to.
+ * @param prompt The message prompt displayed to the user.
+ * @param inputPattern The regular expression pattern for validating user input.
+ * @param userInput Reference to store the user input.
+ * @throws std::runtime_error if in ends before a valid input was read.
+ */
+void getUserInput(std::istream& in, std::ostream& out, const std::string& prompt,
+		const std::string& inputPattern, std::string& userInput);
+
 /**
  * @brief Assert the truth of a condition and display a message on failure.
  *
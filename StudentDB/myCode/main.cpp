@@ -1,6 +1,8 @@
 //! Standard (system) header files
 #include <iostream>
 #include <cstdlib>
+#include <fstream>
+#include <chrono>
 
 using namespace std;
 
@@ -8,14 +10,205 @@ using namespace std;
 #include "SimpleUI.h"
 
 #include "helperFunctions.h"
+#include "Benchmarks.h"
+#include "GeneratorServer.h"
+#include "BatchCommandRunner.h"
+#include "QueryServer.h"
+#include "QueryClient.h"
+#include "SessionServer.h"
+#include "ServerRecordScanner.h"
+
+#include <Poco/Exception.h>
+
+/*!
+ * @brief Reads a database file, see StudentDb::loadFromFile().
+ *
+ * @return False if the file cannot be opened or read.
+ */
+static bool loadDatabase(StudentDb& db, const string& fileName)
+{
+	try
+	{
+		db.loadFromFile(fileName);
+	}
+	catch(const Poco::Exception& error)
+	{
+		cerr << "ERROR: " << error.displayText() << endl;
+
+		return false;
+	}
+	catch(const runtime_error& error)
+	{
+		cerr << "ERROR: " << error.what() << endl;
+
+		return false;
+	}
+
+	return true;
+}
+
+/*!
+ * @brief A generator server response line with the given date of birth,
+ * year since 1900 and month 0 for January as sent by the server.
+ */
+static string serverRecordLine(int year, int month, int day)
+{
+	return R"({"name":{"title":"Mr","firstName":"Tobias","lastName":"Mueller"},)"
+			R"("location":{"street":"Hauptstrasse 12","postCode":64295,)"
+			R"("city":"Darmstadt","state":"Hessen"},)"
+			R"("dateOfBirth":{"year":)" + to_string(year) + R"(,"month":)"
+			+ to_string(month) + R"(,"date":)" + to_string(day) + "}}";
+}
 
 //! Main program
-int main ()
+int main (int argc, char* argv[])
 {
+	//! Benchmark mode: StudentDB --benchmark <name> [noOfRecords]
+	if(argc > 2 && string(argv[1]) == "--benchmark")
+	{
+		unsigned int noOfRecords = (argc > 3) ? stoul(argv[3]) : 100000;
+
+		return runBenchmark(argv[2], noOfRecords, cout) ? 0 : 1;
+	}
+
+	//! Stand-in generator server: StudentDB --generator-server <port> [seed] [latencyMs]
+	if(argc > 2 && string(argv[1]) == "--generator-server")
+	{
+		GeneratorServer server(stoul(argv[2]), (argc > 3) ? stoul(argv[3]) : 42,
+				(argc > 4) ? stoul(argv[4]) : 0);
+
+		cout << "Generator server listening on port " << server.getPort()
+				<< ", press Enter to stop." << endl;
+
+		cin.get();
+
+		return 0;
+	}
+
+	//! Synthetic server capture: StudentDB --write-capture <file> <noOfResponses> [seed]
+	if(argc > 3 && string(argv[1]) == "--write-capture")
+	{
+		ofstream captureFile(argv[2], ios::trunc);
+
+		GeneratorServer::writeResponses(captureFile, stoul(argv[3]),
+				(argc > 4) ? stoul(argv[4]) : 42);
+
+		return captureFile ? 0 : 1;
+	}
+
+	//! Headless batch mode: StudentDB --batch <commandFile> [databaseFile]
+	if(argc > 2 && string(argv[1]) == "--batch")
+	{
+		ifstream commandFile(argv[2]);
+
+		if(!commandFile)
+		{
+			cerr << "ERROR: cannot open " << argv[2] << endl;
+
+			return 1;
+		}
+
+		StudentDb Database;
+
+		if(argc > 3 && !loadDatabase(Database, argv[3]))
+		{
+			return 1;
+		}
+
+		BatchCommandRunner runner(Database);
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+		unsigned int failures = runner.run(commandFile, cout);
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		cout.flush();
+
+		cerr << "Batch finished: " << runner.getNoOfCommands() << " command(s) in "
+				<< seconds << " s (" << runner.getNoOfCommands() / max(seconds, 1e-9)
+				<< " ops/s), " << failures << " failed." << endl;
+
+		return (failures == 0) ? 0 : 2;
+	}
+
+	//! Query service: StudentDB --query-server <port> [databaseFile] [host]
+	if(argc > 2 && string(argv[1]) == "--query-server")
+	{
+		StudentDb Database;
+
+		if(argc > 3 && !loadDatabase(Database, argv[3]))
+		{
+			return 1;
+		}
+
+		//! No authentication, so only local clients by default.
+		QueryServer server(Database, (argc > 4) ? argv[4] : "127.0.0.1", stoul(argv[2]));
+
+		cout << "Query server with " << Database.getNoOfStudents()
+				<< " students listening on port " << server.getPort()
+				<< ", press Enter to stop." << endl;
+
+		cin.get();
+
+		return 0;
+	}
+
+	//! Console sessions: StudentDB --session-server <port> [databaseFile] [host] [maxSessions]
+	if(argc > 2 && string(argv[1]) == "--session-server")
+	{
+		StudentDb Database;
+
+		if(argc > 3 && !loadDatabase(Database, argv[3]))
+		{
+			return 1;
+		}
+
+		//! Sessions read and write files of the server, so only local users by default.
+		SessionServer server(Database, (argc > 4) ? argv[4] : "127.0.0.1", stoul(argv[2]),
+				(argc > 5) ? stoul(argv[5]) : 16);
+
+		cout << "Session server with " << Database.getNoOfStudents()
+				<< " students listening on port " << server.getPort()
+				<< ", press Enter to stop." << endl;
+
+		cin.get();
+
+		return 0;
+	}
+
+	//! Query client: StudentDB --query <host> <port>, one request per line of stdin
+	if(argc > 3 && string(argv[1]) == "--query")
+	{
+		QueryClient client(argv[2], stoul(argv[3]));
+
+		string request;
+
+		while(getline(cin, request) && request != "quit")
+		{
+			QueryResponse response = client.request(request);
+
+			cout << response.code << " " << response.message << endl;
+
+			for(const string& line : response.lines)
+			{
+				cout << "\t" << line << endl;
+			}
+		}
+
+		return 0;
+	}
+
 	cout << "StudentDB started." << endl << endl;
 
 	StudentDb Database;
 
+	//! Other generator server: StudentDB --server <host> <port>
+	if(argc > 3 && string(argv[1]) == "--server")
+	{
+		Database.setServerEndpoint(argv[2], stoul(argv[3]));
+	}
+
 	SimpleUI UI(Database);
 
 	UI.run();
@@ -62,6 +255,31 @@ int main ()
 			Poco::DateTime::MONDAY, stringToPocoTimeFormatter("10:15"), stringToPocoTimeFormatter("11:45"));
 	assertTrue(testCourse10.getSemester() == "WiSe2023", "Test case-10 failed");
 
+	//! Systematic Testing ServerRecordScanner::scan(), Poco::Data::Date
+	//! throws for impossible dates, the scanner has to reject them instead.
+
+	StudentRecord testRecord;
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(97, 2, 31), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Valid, "Test case-11 failed");
+	assertTrue(testRecord.dateOfBirth.day() == 31 && testRecord.dateOfBirth.month() == 3
+			&& testRecord.dateOfBirth.year() == 1997, "Test case-12 failed");
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(97, 1, 31), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Rejected, "Test case-13 failed");
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(97, 1, 29), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Rejected, "Test case-14 failed");
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(96, 1, 29), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Valid, "Test case-15 failed");
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(97, 12, 1), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Rejected, "Test case-16 failed");
+
+	assertTrue(ServerRecordScanner::scan(serverRecordLine(97, 0, 0), testRecord)
+			== ServerRecordScanner::ScanResult_t::SR_Rejected, "Test case-17 failed");
+
 	return 0;
 }
 
@@ -78,11 +296,14 @@ int main ()
 	class SimpleUI
 	{
 		-m_db : StudentDb&
+		-m_in : std::istream&
+		-m_out : std::ostream&
 
-		+SimpleUI(StudentDb& db)
+		+SimpleUI(StudentDb& db, std::istream& in = std::cin, std::ostream& out = std::cout)
 		+~SimpleUI()
 		+run() : void
 
+		-runMenu() : void {query}
 		-getUserInputsforNewCourse() : void {query}
 		-listCourses() : void {query}
 		-getUserInputsforNewStudent() : void {query}
@@ -90,7 +311,7 @@ int main ()
 		-printStudent() : void {query}
         -searchStudent() : void {query}
         -getUserInputforStudentUpdate() : void {query}
-        -performStudentUpdate(unsigned int matrikelNumber, \n const Student& updateStudent) : void {query}
+        -performStudentUpdate(unsigned int matrikelNumber) : void {query}
 //        -getUserInputforFirstName(unsigned int matrikelNumber, \n const Student& updateStudent) : void {query}
 //        -getUserInputforLastName(unsigned int matrikelNumber, \n const Student& updateStudent) : void {query}
 //        -getUserInputforDateOfBirth(unsigned int matrikelNumber, \n const Student& updateStudent) : void {query}
@@ -101,12 +322,16 @@ int main ()
 
 	class StudentDb
 	{
-		-m_students : std::map<int, Student>
+		-m_students : ShardedStudentMap
 		-m_courses : std::map<int, std::unique_ptr<const Course>>
+		-m_coursesMutex : std::shared_timed_mutex
+		-m_courseStatistics : std::map<int, CourseStatistics>
+		-m_workers : WorkStealingPool&
 
 		+StudentDb()
-        +getStudents() : std::map<int , Student>& {query}
-        +getCourses() : std::map<int , std::unique_ptr<const Course>>& {query}
+        +getStudents() : ShardedStudentMap::ReadView {query}
+        +getCourses() : StudentDb::CoursesView {query}
+        +readStudent(unsigned int matrikelNumber, \n const std::function<void(const Student&)>& reader) : bool {query}
 		+addNewCourse(std::string& courseKey, std::string& title, std::string& major, \n std::string& credits, std::string& courseType, \n std::string& startTime, std::string& endTime, \n std::string& startDate, std::string& endDate, \n std::string& dayOfWeek) : StudentDb::RC_StudentDb_t
 		+addNewStudent(std::string& firstName, std::string& lastName, std::string& DoBstring, \n std::string& streetName, std::string& postalCode, \n std::string& cityName, std::string& additionalInfo) : StudentDb::RC_StudentDb_t
 		+addEnrollment(std::string& matrikelNumber, std::string& semester, \n std::string& courseKey) : StudentDb::RC_StudentDb_t
@@ -114,11 +339,13 @@ int main ()
         +updateLastName(const std::string& newLastName, unsigned int matrikelNumber) : void
         +updateDateOfBirth(const Poco::Data::Date& dateOfBirth, unsigned int matrikelNumber) : void
         +updateAddress(const std::string& street, const unsigned int& postalCode, \n const std::string& cityName, const std::string& additionalInfo, \n unsigned int matrikelNumber) : void
-        +deleteEnrollment(const unsigned int& courseKey, const unsigned int matrikelNumber) : void
-        +updateGrade(const unsigned int& courseKey, const float& newGrade, \n const unsigned int matrikelNumber) : void
+        +deleteEnrollment(const unsigned int& courseKey, const unsigned int matrikelNumber) : RC_StudentDb_t
+        +updateGrade(const unsigned int& courseKey, const float& newGrade, \n const unsigned int matrikelNumber) : RC_StudentDb_t
+        +rankByGpa() : std::vector<std::pair<unsigned int, float>> {query}
+        +getCourseStatistics(int courseKey) : CourseStatistics {query}
         +write(std::ostream& out) : void {query}
         +read(std::istream& in) : void
-        +readStudentDataFromServer(unsigned int noOfUserData) : void
+        +readStudentDataFromServer(unsigned int noOfUserData, std::ostream& report) : void
 
         -readCoursesData(std::string& str) : void
         -readStudentsData(std::string& str) : void
@@ -132,23 +359,29 @@ int main ()
 
 	class Student
 	{
-		-{static} m_nextMatrikelNumber : static unsigned int
+		-{static} m_matrikelAllocator : static MatrikelAllocator
 		-m_matrikelNumber : unsigned int
 		-m_firstName : std::string
 		-m_lastName : std::string
 		-m_dateOfBirth : Poco::Data::Date
 		-m_enrollments : std::vector<Enrollment>
+		-m_gradedCredits : double
+		-m_weightedGradeSum : double
 		-m_address : std::shared_ptr<Address>
 
 		+Student(std::string firstName, std::string lastName,\n Poco::Data::Date dateOfBirth, std::shared_ptr<Address> address)
+		+Student(unsigned int matrikelNumber, std::string firstName, std::string lastName,\n Poco::Data::Date dateOfBirth, std::shared_ptr<Address> address)
+		+Student(unsigned int matrikelNumber, const Student& student)
 		+~Student()
 		+getMatrikelNumber() : unsigned int {query}
 		+getFirstName() : std::string& {query}
         +getLastName() : std::string& {query}
 		+getDateOfBirth() : Poco::Data::Date {query}
 		+getEnrollments() : std::vector<Enrollment>& {query}
+		+getGpa() : float {query}
+		+getGradedCredits() : double {query}
 		+getAddress() : std::shared_ptr<Address> {query}
-		+{static} setNextMatrikelNumber(unsigned int newMatrikelNumber) : void
+		+{static} getMatrikelAllocator() : MatrikelAllocator&
         +setFirstName(const std::string& firstName) : void
         +setLastName(const std::string& lastName) : void
         +setDateOfBirth(const Poco::Data::Date& dateOfBirth) : void